@@ -19,6 +19,7 @@ STATIC_MEMORY(CoreInput,           Core::Input)
 STATIC_MEMORY(CorePlatform,        Core::Platform)
 STATIC_MEMORY(CoreDebug,           Core::Debug)
 STATIC_MEMORY(coreMemoryManager,   Core::Manager::Memory)
+STATIC_MEMORY(coreJobManager,      Core::Manager::Job)
 STATIC_MEMORY(coreResourceManager, Core::Manager::Resource)
 STATIC_MEMORY(coreObjectManager,   Core::Manager::Object)
 STATIC_MEMORY(CoreApp,             Core::Application)
@@ -50,6 +51,7 @@ Core::Core()noexcept
     // init managers
     Log->Header("Other");
     STATIC_NEW(Manager::Memory)
+    STATIC_NEW(Manager::Job)
     STATIC_NEW(Manager::Resource)
     STATIC_NEW(Manager::Object)
 
@@ -91,8 +93,27 @@ Core::~Core()
     // delete managers
     STATIC_DELETE(Manager::Object)
     STATIC_DELETE(Manager::Resource)
+    STATIC_DELETE(Manager::Job)
     STATIC_DELETE(Manager::Memory)
 
+#if defined(_CORE_LOCKSTATS_)
+
+    // write lock statistics (after most threads are finished)
+    Log->ListStartInfo("Lock Statistics");
+    {
+        coreLockStats::ForEach([](const coreLockStats& oStats)
+        {
+            const coreUint64 iAcquired  = oStats.iAcquired .load(std::memory_order::relaxed);
+            const coreUint64 iContended = oStats.iContended.load(std::memory_order::relaxed);
+            const coreDouble dSpinTime  = coreDouble(oStats.iSpinTime.load(std::memory_order::relaxed)) * System->GetPerfFrequency() * 1000.0;
+
+            Log->ListAdd(CORE_LOG_BOLD("%s:") " %llu acquisitions, %llu contended (%.2f%%), %.3f ms spinning", oStats.pcName, iAcquired, iContended, iAcquired ? (coreDouble(iContended) / coreDouble(iAcquired) * 100.0) : 0.0, dSpinTime);
+        });
+    }
+    Log->ListEnd();
+
+#endif
+
     // delete main components
     STATIC_DELETE(Input)
     STATIC_DELETE(Audio)
@@ -267,6 +288,18 @@ coreStatus Core::Run()
             Core::Manager::Resource->UpdateResources();
             Core::Manager::Resource->UpdateFunctions();
         }
+
+        // reload resources with changed resource files
+        Core::Manager::Resource->__UpdateWatch();
+
+        // switch from placeholders to loaded resources between frames
+        Core::Manager::Resource->__UpdatePlaceholder();
+
+        // unload unreferenced resources at the end of the frame
+        Core::Manager::Resource->__UpdateUnload();
+
+        // release temporary memory of the current frame
+        Core::Manager::Memory->__UpdateFrame();
     }
 
 #if defined(_CORE_EMSCRIPTEN_)
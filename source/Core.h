@@ -138,6 +138,11 @@
     #define _CORE_TEST_
 #endif
 
+// lock statistics mode (opt-in, records acquisitions and contention of named locks)
+#if defined(CORE_LOCKSTATS)
+    #define _CORE_LOCKSTATS_
+#endif
+
 // mobile mode
 #if defined(_CORE_ANDROID_) || defined(_CORE_IOS_)
     #define _CORE_MOBILE_
@@ -648,6 +653,7 @@ class  CoreInput;
 class  CorePlatform;
 class  CoreDebug;
 class  coreMemoryManager;
+class  coreJobManager;
 class  coreResourceManager;
 class  coreObjectManager;
 
@@ -727,6 +733,7 @@ public:
     struct INTERFACE Manager final
     {
         static coreMemoryManager*   const Memory;     // memory manager
+        static coreJobManager*      const Job;        // job manager
         static coreResourceManager* const Resource;   // resource manager
         static coreObjectManager*   const Object;     // object manager
     };
@@ -792,6 +799,7 @@ private:
 #include "components/system/coreTimer.h"
 #include "components/system/coreThread.h"
 #include "manager/coreMemory.h"
+#include "manager/coreJob.h"
 #include "manager/coreResource.h"
 #include "components/graphics/coreSync.h"
 #include "components/graphics/coreDataBuffer.h"
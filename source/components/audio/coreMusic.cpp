@@ -237,15 +237,26 @@ coreStatus coreMusicPlayer::AddMusicArchive(const coreChar* pcPath, const coreCh
     // retrieve archive with resource files
     coreArchive* pArchive = Core::Manager::Resource->RetrieveArchive(pcPath);
 
-    // try to add all files to the music-player
+    // get specific files from the archive
+    coreList<coreFile*> apFile;
     for(coreUintW i = 0u, ie = pArchive->GetNumFiles(); i < ie; ++i)
     {
         // check path and use only specific files
         if(coreData::StrCmpLike(pArchive->GetFile(i)->GetPath(), pcFilter))
-        {
-            if(this->__AddMusic(pArchive->GetFile(i)) == CORE_OK)
-                bStatus = true;
-        }
+            apFile.push_back(pArchive->GetFile(i));
+    }
+
+    // sort by path (archive is sorted by path hash)
+    std::sort(apFile.begin(), apFile.end(), [](const coreFile* A, const coreFile* B)
+    {
+        return (std::strcmp(A->GetPath(), B->GetPath()) < 0);
+    });
+
+    // try to add all files to the music-player
+    FOR_EACH(it, apFile)
+    {
+        if(this->__AddMusic(*it) == CORE_OK)
+            bStatus = true;
     }
 
     return bStatus ? CORE_OK : CORE_INVALID_INPUT;
@@ -144,6 +144,20 @@ coreStatus coreSound::Unload()
 }
 
 
+// ****************************************************************
+/* get estimated memory usage */
+coreUintW coreSound::GetMemorySize()const
+{
+    if(!m_iBuffer) return 0u;
+
+    // query size of the sound buffer
+    ALint iSize = 0;
+    alGetBufferi(m_iBuffer, AL_SIZE, &iSize);
+
+    return iSize;
+}
+
+
 // ****************************************************************
 /* play the sound with positional behavior */
 void coreSound::PlayPosition(const void* pRef, const coreFloat fVolume, const coreFloat fPitch, const coreBool bLoop, const coreUint8 iType, const coreVector3 vPosition)
@@ -42,6 +42,9 @@ public:
     coreStatus Load(coreFile* pFile)final;
     coreStatus Unload()final;
 
+    /* get estimated memory usage (without sub-fonts) */
+    inline coreUintW GetMemorySize()const final {return m_pFile ? m_pFile->GetSize() : 0u;}
+
     /* create solid text with the font */
     SDL_Surface* CreateText (const coreChar*  pcText, const coreUint16 iHeight);
     SDL_Surface* CreateGlyph(const coreChar32 iGlyph, const coreUint16 iHeight);
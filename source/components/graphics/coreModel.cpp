@@ -38,6 +38,8 @@ coreModel::coreModel(const coreModelLoad eLoad)noexcept
 , m_iIndexType          (0u)
 , m_eLoad               (eLoad)
 , m_Sync                ()
+, m_pDecodeVertex       (NULL)
+, m_piDecodeIndex       (NULL)
 {
 }
 
@@ -58,11 +60,56 @@ coreStatus coreModel::Load(coreFile* pFile)
     const coreStatus eCheck = m_Sync.Check(0u, CORE_SYNC_CHECK_FLUSHED);
     if(eCheck >= CORE_OK) return eCheck;
 
+    // decode model file (if not already done on a worker thread)
+    if(!m_piDecodeIndex)
+    {
+        const coreStatus eDecode = this->Decode(pFile);
+        if(eDecode != CORE_OK) return eDecode;
+    }
+
+    if(!HAS_FLAG(m_eLoad, CORE_MODEL_LOAD_NO_BUFFERS))
+    {
+        if(CORE_GL_SUPPORT(ARB_vertex_type_2_10_10_10_rev) && CORE_GL_SUPPORT(ARB_half_float_vertex))
+        {
+            // create vertex buffer (high quality compression, de-interleaved)
+            coreVertexBuffer* pBuffer = this->CreateVertexBuffer(m_iNumVertices, 20u, m_pDecodeVertex, CORE_DATABUFFER_STORAGE_STATIC);
+            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_POSITION_NUM, 4u, GL_HALF_FLOAT,         8u, false, 0u,  0u);
+            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TEXCOORD_NUM, 2u, GL_UNSIGNED_SHORT,     4u, false, 8u,  0u);
+            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_NORMAL_NUM,   4u, GL_INT_2_10_10_10_REV, 4u, false, 12u, 0u);
+            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TANGENT_NUM,  4u, GL_INT_2_10_10_10_REV, 4u, false, 16u, 0u);
+        }
+        else
+        {
+            // create vertex buffer (low quality compression, de-interleaved)
+            coreVertexBuffer* pBuffer = this->CreateVertexBuffer(m_iNumVertices, 24u, m_pDecodeVertex, CORE_DATABUFFER_STORAGE_STATIC);
+            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_POSITION_NUM, 3u, GL_FLOAT,          12u, false, 0u,  0u);
+            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TEXCOORD_NUM, 2u, GL_UNSIGNED_SHORT, 4u,  false, 12u, 0u);
+            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_NORMAL_NUM,   4u, GL_BYTE,           4u,  false, 16u, 0u);
+            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TANGENT_NUM,  4u, GL_BYTE,           4u,  false, 20u, 0u);
+        }
+
+        // create index buffer
+        this->CreateIndexBuffer(m_iNumIndices, sizeof(coreUint16), m_piDecodeIndex, CORE_DATABUFFER_STORAGE_STATIC);
+    }
+
+    // free decoded data
+    SAFE_DELETE_ARRAY(m_pDecodeVertex)
+    SAFE_DELETE_ARRAY(m_piDecodeIndex)
+
+    Core::Log->Info("Model (%s, %u vertices, %u indices, %u clusters, %.5f x %.5f x %.5f range, %.5f radius) loaded", m_sPath.c_str(), m_iNumVertices, m_iNumIndices, m_iNumClusters, m_vBoundingRange.x, m_vBoundingRange.y, m_vBoundingRange.z, m_fBoundingRadius);
+    return m_Sync.Create() ? CORE_BUSY : CORE_OK;
+}
+
+
+// ****************************************************************
+/* decode model resource data */
+coreStatus coreModel::Decode(coreFile* pFile)
+{
     coreFileScope oUnloader(pFile);
 
-    WARN_IF(!m_aVertexBuffer.empty()) return CORE_INVALID_CALL;
-    if(!pFile)                        return CORE_INVALID_INPUT;
-    if(!pFile->GetData())             return CORE_ERROR_FILE;
+    WARN_IF(!m_aVertexBuffer.empty() || m_iNumVertices) return CORE_INVALID_CALL;
+    if(!pFile)                                          return CORE_INVALID_INPUT;
+    if(!pFile->GetData())                               return CORE_ERROR_FILE;
 
     // extract file extension
     const coreChar* pcExtension = coreData::StrToLower(coreData::StrExtension(pFile->GetPath()));
@@ -260,7 +307,7 @@ coreStatus coreModel::Load(coreFile* pFile)
         if(CORE_GL_SUPPORT(ARB_vertex_type_2_10_10_10_rev) && CORE_GL_SUPPORT(ARB_half_float_vertex))
         {
             // reduce total vertex size (high quality compression, de-interleaved)
-            coreByte* pPackedData = new coreByte[20u * m_iNumVertices];
+            coreByte* pPackedData = m_pDecodeVertex = new coreByte[20u * m_iNumVertices];
             for(coreUintW i = 0u, ie = m_iNumVertices; i < ie; ++i)
             {
                 const coreVertex& oVertex = oImport.aVertexData[i];
@@ -271,19 +318,11 @@ coreStatus coreModel::Load(coreFile* pFile)
                 r_cast<coreUint32*>(pPackedData + 12u * m_iNumVertices)[i] = coreVector4(oVertex.vNormal,   0.0f).PackSnorm210 ();
                 r_cast<coreUint32*>(pPackedData + 16u * m_iNumVertices)[i] = oVertex.vTangent                    .PackSnorm210 ();
             }
-
-            // create vertex buffer
-            coreVertexBuffer* pBuffer = this->CreateVertexBuffer(m_iNumVertices, 20u, pPackedData, CORE_DATABUFFER_STORAGE_STATIC);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_POSITION_NUM, 4u, GL_HALF_FLOAT,         8u, false, 0u,  0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TEXCOORD_NUM, 2u, GL_UNSIGNED_SHORT,     4u, false, 8u,  0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_NORMAL_NUM,   4u, GL_INT_2_10_10_10_REV, 4u, false, 12u, 0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TANGENT_NUM,  4u, GL_INT_2_10_10_10_REV, 4u, false, 16u, 0u);
-            SAFE_DELETE_ARRAY(pPackedData)
         }
         else
         {
             // reduce total vertex size (low quality compression, de-interleaved)
-            coreByte* pPackedData = new coreByte[24u * m_iNumVertices];
+            coreByte* pPackedData = m_pDecodeVertex = new coreByte[24u * m_iNumVertices];
             for(coreUintW i = 0u, ie = m_iNumVertices; i < ie; ++i)
             {
                 const coreVertex& oVertex = oImport.aVertexData[i];
@@ -294,25 +333,13 @@ coreStatus coreModel::Load(coreFile* pFile)
                 r_cast<coreUint32*> (pPackedData + 16u * m_iNumVertices)[i] = coreVector4(oVertex.vNormal, 0.0f).PackSnorm4x8 ();
                 r_cast<coreUint32*> (pPackedData + 20u * m_iNumVertices)[i] = oVertex.vTangent                  .PackSnorm4x8 ();
             }
-
-            // create vertex buffer
-            coreVertexBuffer* pBuffer = this->CreateVertexBuffer(m_iNumVertices, 24u, pPackedData, CORE_DATABUFFER_STORAGE_STATIC);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_POSITION_NUM, 3u, GL_FLOAT,          12u, false, 0u,  0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TEXCOORD_NUM, 2u, GL_UNSIGNED_SHORT, 4u,  false, 12u, 0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_NORMAL_NUM,   4u, GL_BYTE,           4u,  false, 16u, 0u);
-            pBuffer->DefineAttribute(CORE_SHADER_ATTRIBUTE_TANGENT_NUM,  4u, GL_BYTE,           4u,  false, 20u, 0u);
-            SAFE_DELETE_ARRAY(pPackedData)
         }
-
-        // create index buffer
-        this->CreateIndexBuffer(m_iNumIndices, sizeof(coreUint16), piOptimizedData, CORE_DATABUFFER_STORAGE_STATIC);
     }
 
-    // free index data
-    SAFE_DELETE_ARRAY(piOptimizedData)
+    // keep index data for the upload
+    m_piDecodeIndex = piOptimizedData;
 
-    Core::Log->Info("Model (%s, %u vertices, %u indices, %u clusters, %.5f x %.5f x %.5f range, %.5f radius) loaded", pFile->GetPath(), m_iNumVertices, m_iNumIndices, m_iNumClusters, m_vBoundingRange.x, m_vBoundingRange.y, m_vBoundingRange.z, m_fBoundingRadius);
-    return m_Sync.Create() ? CORE_BUSY : CORE_OK;
+    return CORE_OK;
 }
 
 
@@ -322,6 +349,10 @@ coreStatus coreModel::Unload()
 {
     if(!m_iNumVertices) return CORE_INVALID_CALL;
 
+    // free decoded data (not uploaded yet)
+    SAFE_DELETE_ARRAY(m_pDecodeVertex)
+    SAFE_DELETE_ARRAY(m_piDecodeIndex)
+
     // disable still active model
     if(s_pCurrent == this) coreModel::Disable(true);
 
@@ -364,6 +395,23 @@ coreStatus coreModel::Unload()
 }
 
 
+// ****************************************************************
+/* get estimated memory usage */
+coreUintW coreModel::GetMemorySize()const
+{
+    if(!m_iNumVertices) return 0u;
+
+    // add all data buffers
+    coreUintW iSize = m_IndexBuffer.GetSize();
+    FOR_EACH(it, m_aVertexBuffer) iSize += it->GetSize();
+
+    // add cluster memory
+    if(m_iNumClusters) iSize += m_iNumVertices * sizeof(coreVector3) + m_iNumIndices * sizeof(coreUint16) + m_iNumClusters * (sizeof(coreUint16*) + sizeof(coreUint16) + sizeof(coreVector3) + sizeof(coreFloat));
+
+    return iSize;
+}
+
+
 // ****************************************************************
 /* draw the model */
 void coreModel::DrawArrays()const
@@ -84,6 +84,9 @@ private:
 
     coreSync m_Sync;                              // sync object for asynchronous model loading
 
+    coreByte*   m_pDecodeVertex;                  // packed vertex data (waiting for upload)
+    coreUint16* m_piDecodeIndex;                  // optimized index data (waiting for upload)
+
     static coreModel* s_pCurrent;                 // currently active model object
 
 
@@ -97,6 +100,13 @@ public:
     coreStatus Load(coreFile* pFile)final;
     coreStatus Unload()final;
 
+    /* decode model resource data (without graphics context) */
+    coreStatus      Decode     (coreFile* pFile)final;
+    inline coreBool IsDecodable()const final {return !m_iNumVertices;}
+
+    /* get estimated memory usage */
+    coreUintW GetMemorySize()const final;
+
     /* draw the model */
     inline void Draw        ()const {if(m_IndexBuffer.IsValid()) this->DrawElements(); else this->DrawArrays();}
     void        DrawArrays  ()const;
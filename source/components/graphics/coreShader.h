@@ -169,6 +169,9 @@ public:
     coreBool Enable();
     static void Disable(const coreBool bFull);
 
+    /* check for dependency on attached shader objects */
+    inline coreBool IsDependent(const coreResourceHandle* pHandle)const final {return (std::find(m_apShaderHandle.begin(), m_apShaderHandle.end(), pHandle) != m_apShaderHandle.end());}
+
     /* execute compute shader-program */
     coreStatus DispatchCompute(const coreUint32 iGroupsX, const coreUint32 iGroupsY, const coreUint32 iGroupsZ)const;
 
@@ -16,15 +16,18 @@ coreTexture* coreTexture::s_apBound[CORE_TEXTURE_UNITS] = {};
 // ****************************************************************
 /* constructor */
 coreTexture::coreTexture(const coreTextureLoad eLoad)noexcept
-: coreResource  ()
-, m_iIdentifier (0u)
-, m_vResolution (coreVector2(0.0f,0.0f))
-, m_iLevels     (0u)
-, m_bCompressed (false)
-, m_eMode       (CORE_TEXTURE_MODE_DEFAULT)
-, m_Spec        (coreTextureSpec(0u, 0u, 0u))
-, m_eLoad       (eLoad)
-, m_Sync        ()
+: coreResource     ()
+, m_iIdentifier    (0u)
+, m_vResolution    (coreVector2(0.0f,0.0f))
+, m_iLevels        (0u)
+, m_bCompressed    (false)
+, m_eMode          (CORE_TEXTURE_MODE_DEFAULT)
+, m_Spec           (coreTextureSpec(0u, 0u, 0u))
+, m_eLoad          (eLoad)
+, m_Sync           ()
+, m_pDecodeSurface (NULL)
+, m_pDecodeChain   (NULL)
+, m_iDecodeLevels  (0u)
 {
 }
 
@@ -45,31 +48,41 @@ coreStatus coreTexture::Load(coreFile* pFile)
     const coreStatus eCheck = m_Sync.Check(0u, CORE_SYNC_CHECK_FLUSHED);
     if(eCheck >= CORE_OK) return eCheck;
 
-    WARN_IF(m_iIdentifier) return CORE_INVALID_CALL;
-    if(!pFile)             return CORE_INVALID_INPUT;
-    if(!pFile->GetSize())  return CORE_ERROR_FILE;   // do not load file data
-
-    // decompress file to plain pixel data
-    coreSurfaceScope pData = IMG_LoadTyped_RW(pFile->CreateReadStream(), 1, coreData::StrExtension(pFile->GetPath()));
-    if(!pData)
+    // decode texture file (if not already done on a worker thread)
+    if(!m_pDecodeSurface)
     {
-        Core::Log->Warning("Texture (%s) could not be loaded (SDL: %s)", pFile->GetPath(), SDL_GetError());
-        return CORE_INVALID_DATA;
+        const coreStatus eDecode = this->Decode(pFile);
+        if(eDecode != CORE_OK) return eDecode;
     }
 
+    // take over decoded pixel data
+    coreSurfaceScope pData = m_pDecodeSurface;
+    m_pDecodeSurface = NULL;
+
     // calculate data size
     const coreUint8  iComponents = pData->format->BytesPerPixel;
     const coreUint32 iDataSize   = pData->w * pData->h * iComponents;
     ASSERT(iComponents && iDataSize)
 
-    // check load configuration
-    const coreTextureMode eMode = ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NO_COMPRESS) && coreMath::IsPot(pData->w) && coreMath::IsPot(pData->h)) ? CORE_TEXTURE_MODE_COMPRESS : CORE_TEXTURE_MODE_DEFAULT) |
-                                  ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NO_FILTER))                                                             ? CORE_TEXTURE_MODE_FILTER   : CORE_TEXTURE_MODE_DEFAULT) |
-                                  ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NEAREST))                                                               ? CORE_TEXTURE_MODE_DEFAULT  : CORE_TEXTURE_MODE_NEAREST);
-
     // create texture
-    this->Create(pData->w, pData->h, CORE_TEXTURE_SPEC_COMPONENTS(iComponents), eMode | CORE_TEXTURE_MODE_REPEAT);
-    this->Modify(0u, 0u, pData->w, pData->h, iDataSize, s_cast<coreByte*>(pData->pixels));
+    this->Create(pData->w, pData->h, CORE_TEXTURE_SPEC_COMPONENTS(iComponents), this->__GetLoadMode(pData->w, pData->h) | CORE_TEXTURE_MODE_REPEAT);
+
+    // check for matching pre-compressed image chain
+    const coreUint8 iChainLevels = (CORE_GL_SUPPORT(EXT_framebuffer_object) && (m_iLevels > 1u)) ? m_iLevels : 1u;
+    if(m_pDecodeChain && m_bCompressed && (m_iDecodeLevels == iChainLevels))
+    {
+        // upload pre-compressed image chain
+        this->__ModifyCompressed(iComponents, m_iDecodeLevels, m_pDecodeChain);
+    }
+    else
+    {
+        // upload (and compress) plain pixel data
+        this->Modify(0u, 0u, pData->w, pData->h, iDataSize, s_cast<coreByte*>(pData->pixels));
+    }
+
+    // free pre-compressed image chain
+    SAFE_DELETE_ARRAY(m_pDecodeChain)
+    m_iDecodeLevels = 0u;
 
     // save properties
     m_sPath = pFile->GetPath();
@@ -83,6 +96,12 @@ coreStatus coreTexture::Load(coreFile* pFile)
 /* unload texture resource data */
 coreStatus coreTexture::Unload()
 {
+    // free decoded data (not uploaded yet)
+    if(m_pDecodeSurface) SDL_FreeSurface(m_pDecodeSurface);
+    SAFE_DELETE_ARRAY(m_pDecodeChain)
+    m_pDecodeSurface = NULL;
+    m_iDecodeLevels  = 0u;
+
     if(!m_iIdentifier) return CORE_INVALID_CALL;
 
     // disable still active texture bindings
@@ -109,6 +128,81 @@ coreStatus coreTexture::Unload()
 }
 
 
+// ****************************************************************
+/* get estimated memory usage */
+coreUintW coreTexture::GetMemorySize()const
+{
+    if(!m_iIdentifier) return 0u;
+
+    // get size per texel (doubled, to handle compressed formats)
+    coreUintW iTexelSize2;
+    switch(m_Spec.iInternal)
+    {
+    case GL_COMPRESSED_RED_RGTC1:
+    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:  iTexelSize2 = 1u;  break;
+    case GL_COMPRESSED_RG_RGTC2:
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT: iTexelSize2 = 2u;  break;
+    case GL_LUMINANCE8:
+    case GL_R8:
+    case GL_STENCIL_INDEX8:                iTexelSize2 = 2u;  break;
+    case GL_RG8:
+    case GL_LUMINANCE16:
+    case GL_R16:
+    case GL_R16F:
+    case GL_DEPTH_COMPONENT16:             iTexelSize2 = 4u;  break;
+    case GL_RGB8:                          iTexelSize2 = 6u;  break;
+    case GL_RGB16:
+    case GL_RGB16F:                        iTexelSize2 = 12u; break;
+    case GL_RGBA16:
+    case GL_RGBA16F:                       iTexelSize2 = 16u; break;
+    default:                               iTexelSize2 = 8u;  break;
+    }
+
+    // calculate size of the base level (and approximate all additional levels)
+    const coreUintW iSize = (F_TO_UI(m_vResolution.x) * F_TO_UI(m_vResolution.y) * iTexelSize2) / 2u;
+    return (m_iLevels > 1u) ? (iSize + iSize / 3u) : iSize;
+}
+
+
+// ****************************************************************
+/* decode texture resource data */
+coreStatus coreTexture::Decode(coreFile* pFile)
+{
+    coreFileScope oUnloader(pFile);
+
+    WARN_IF(m_iIdentifier || m_pDecodeSurface) return CORE_INVALID_CALL;
+    if(!pFile)                                 return CORE_INVALID_INPUT;
+    if(!pFile->GetSize())                      return CORE_ERROR_FILE;   // do not load file data
+
+    // decompress file to plain pixel data
+    SDL_Surface* pData = IMG_LoadTyped_RW(pFile->CreateReadStream(), 1, coreData::StrExtension(pFile->GetPath()));
+    if(!pData)
+    {
+        Core::Log->Warning("Texture (%s) could not be loaded (SDL: %s)", pFile->GetPath(), SDL_GetError());
+        return CORE_INVALID_DATA;
+    }
+
+    // check for texture compression (same conditions as in Create)
+    const coreUint8       iComponents = pData->format->BytesPerPixel;
+    const coreTextureMode eMode       = this->__GetLoadMode(pData->w, pData->h);
+    const coreBool        bCompress   = Core::Config->GetBool(CORE_CONFIG_GRAPHICS_TEXTURECOMPRESSION) && HAS_FLAG(eMode, CORE_TEXTURE_MODE_COMPRESS) && !CORE_GL_SUPPORT(ES2_restriction) && (pData->w >= 4) && (pData->h >= 4);
+
+    if(bCompress && coreTexture::__GetCompressedFormat(CORE_TEXTURE_SPEC_COMPONENTS(iComponents).iInternal))
+    {
+        const coreUint32 iMin = MIN(pData->w, pData->h);
+
+        // pre-compress all required texture levels (expensive part of the upload)
+        m_iDecodeLevels = (CORE_GL_SUPPORT(EXT_framebuffer_object) && HAS_FLAG(eMode, CORE_TEXTURE_MODE_FILTER)) ? MAX(F_TO_UI(LOG2(I_TO_F(iMin))) - 1u, 1u) : 1u;
+        m_pDecodeChain  = coreTexture::CreateCompressedChain(pData->w, pData->h, iComponents, m_iDecodeLevels, s_cast<coreByte*>(pData->pixels));
+    }
+
+    // keep pixel data for the upload
+    m_pDecodeSurface = pData;
+
+    return CORE_OK;
+}
+
+
 // ****************************************************************
 /* create texture memory */
 void coreTexture::Create(const coreUint32 iWidth, const coreUint32 iHeight, const coreTextureSpec& oSpec, const coreTextureMode eMode)
@@ -144,16 +238,7 @@ void coreTexture::Create(const coreUint32 iWidth, const coreUint32 iHeight, cons
         else
         {
             // overwrite with appropriate compressed texture format (RGTC or S3TC)
-            GLenum iNewFormat = 0u;
-            switch(m_Spec.iInternal)
-            {
-            default: ASSERT(false)
-            case GL_LUMINANCE8:
-            case GL_R8:    if(CORE_GL_SUPPORT(ARB_texture_compression_rgtc)) iNewFormat = GL_COMPRESSED_RED_RGTC1;          break;
-            case GL_RG8:   if(CORE_GL_SUPPORT(ARB_texture_compression_rgtc)) iNewFormat = GL_COMPRESSED_RG_RGTC2;           break;
-            case GL_RGB8:  if(CORE_GL_SUPPORT(EXT_texture_compression_s3tc)) iNewFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;  break;
-            case GL_RGBA8: if(CORE_GL_SUPPORT(EXT_texture_compression_s3tc)) iNewFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
-            }
+            const GLenum iNewFormat = coreTexture::__GetCompressedFormat(m_Spec.iInternal);
             if(iNewFormat) {m_Spec.iInternal = m_Spec.iFormat = iNewFormat; m_bCompressed = true; if(bMipMap || bMipMapOld) m_iLevels = F_TO_UI(LOG2(m_vResolution.Min())) - 1u;}
         }
     }
@@ -202,50 +287,14 @@ void coreTexture::Modify(const coreUint32 iOffsetX, const coreUint32 iOffsetY, c
     {
         ASSERT((iWidth == F_TO_UI(m_vResolution.x)) && (iHeight == F_TO_UI(m_vResolution.y)) && iDataSize && pData)
 
-        // bind texture (simple)
-        glBindTexture(GL_TEXTURE_2D, m_iIdentifier);
-        s_apBound[s_iActiveUnit] = NULL;
-
-        // calculate components and compressed size
+        // calculate components
         const coreUint32 iComponents = iDataSize / (iWidth * iHeight);
-        const coreUint32 iPackedSize = iDataSize / stb_compress_dxt_ratio(iComponents);
-
-        // allocate required image memory
-        coreByte* pPackedData  = new coreByte[iPackedSize];
-        coreByte* apMipData[2] = {NULL, NULL};
-        if(bMipMap)
-        {
-            apMipData[0] = new coreByte[iDataSize >> 2u];
-            apMipData[1] = new coreByte[iDataSize >> 4u];
-        }
-
-        // process all available texture levels
-        for(coreUintW i = 0u, ie = m_iLevels; i < ie; ++i)
-        {
-            const coreUint32 iCurWidth  = iWidth  >> i;
-            const coreUint32 iCurHeight = iHeight >> i;
-            const coreUint32 iCurSize   = iPackedSize >> i >> i;
-
-            // create compressed image
-            coreTexture::CreateCompressed(iCurWidth, iCurHeight, iComponents, pData, pPackedData);
-
-            // upload image to texture
-            coreDataBuffer oBuffer;
-            if(bPixelBuffer) oBuffer.Create(GL_PIXEL_UNPACK_BUFFER, iCurSize, pPackedData, CORE_DATABUFFER_STORAGE_STREAM);
-            glCompressedTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, iCurWidth, iCurHeight, m_Spec.iFormat, iCurSize, bPixelBuffer ? NULL : pPackedData);
-
-            // check for still valid resolution
-            if((iCurWidth <= 4u) || (iCurHeight <= 4u) || !bMipMap) break;
+        const coreUint8  iLevels     = bMipMap ? m_iLevels : 1u;
 
-            // create next level-of-detail image
-            coreTexture::CreateNextLevel(iCurWidth, iCurHeight, iComponents, pData, apMipData[i % 2u]);
-            pData = apMipData[i % 2u];
-        }
-
-        // free required image memory
-        SAFE_DELETE_ARRAY(pPackedData)
-        SAFE_DELETE_ARRAY(apMipData[0])
-        SAFE_DELETE_ARRAY(apMipData[1])
+        // create and upload compressed image chain with all required levels
+        coreByte* pChain = coreTexture::CreateCompressedChain(iWidth, iHeight, iComponents, iLevels, pData);
+        this->__ModifyCompressed(iComponents, iLevels, pChain);
+        SAFE_DELETE_ARRAY(pChain)
     }
     else
     {
@@ -419,9 +468,9 @@ void coreTexture::EnableAll(const coreResourcePtr<coreTexture>* ppTextureArray)
         // loop through all textures
         for(coreUintW i = 0u; i < CORE_TEXTURE_UNITS; ++i)
         {
-            if(ppTextureArray[i].IsUsable())
+            if(ppTextureArray[i].IsServable())
             {
-                coreTexture* pTexture = ppTextureArray[i].GetResource();
+                coreTexture* pTexture = ppTextureArray[i].GetServed();
 
                 // insert texture identifier
                 aiIdentifier[i] = pTexture->GetIdentifier();
@@ -450,7 +499,7 @@ void coreTexture::EnableAll(const coreResourcePtr<coreTexture>* ppTextureArray)
     {
         // enable all separately
         for(coreUintW i = 0u; i < CORE_TEXTURE_UNITS; ++i)
-            if(ppTextureArray[i].IsUsable()) ppTextureArray[i]->Enable(i);
+            if(ppTextureArray[i].IsServable()) ppTextureArray[i].GetServed()->Enable(i);
     }
 }
 
@@ -600,6 +649,116 @@ void coreTexture::CreateCompressed(const coreUintW iInWidth, const coreUintW iIn
 }
 
 
+// ****************************************************************
+/* create compressed image chain with multiple levels-of-detail */
+RETURN_RESTRICT coreByte* coreTexture::CreateCompressedChain(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreUintW iLevels, const coreByte* pInput)
+{
+    ASSERT(iLevels && ((iInWidth >> (iLevels - 1u)) >= 4u) && ((iInHeight >> (iLevels - 1u)) >= 4u))
+
+    // calculate total compressed size
+    const coreUintW iDataSize   = iInWidth * iInHeight * iComponents;
+    const coreUintW iPackedSize = iDataSize / stb_compress_dxt_ratio(iComponents);
+    coreUintW iTotalSize = 0u;
+    for(coreUintW i = 0u; i < iLevels; ++i) iTotalSize += iPackedSize >> i >> i;
+
+    // allocate required image memory
+    coreByte* pOutput      = new coreByte[iTotalSize];
+    coreByte* apMipData[2] = {NULL, NULL};
+    if(iLevels > 1u)
+    {
+        apMipData[0] = new coreByte[iDataSize >> 2u];
+        apMipData[1] = new coreByte[iDataSize >> 4u];
+    }
+
+    // process all requested texture levels
+    coreByte* pCursor = pOutput;
+    for(coreUintW i = 0u; i < iLevels; ++i)
+    {
+        const coreUintW iCurWidth  = iInWidth  >> i;
+        const coreUintW iCurHeight = iInHeight >> i;
+
+        // create compressed image
+        coreTexture::CreateCompressed(iCurWidth, iCurHeight, iComponents, pInput, pCursor);
+        pCursor += iPackedSize >> i >> i;
+
+        // create next level-of-detail image
+        if(i + 1u < iLevels)
+        {
+            coreTexture::CreateNextLevel(iCurWidth, iCurHeight, iComponents, pInput, apMipData[i % 2u]);
+            pInput = apMipData[i % 2u];
+        }
+    }
+
+    // free required image memory
+    SAFE_DELETE_ARRAY(apMipData[0])
+    SAFE_DELETE_ARRAY(apMipData[1])
+
+    return pOutput;
+}
+
+
+// ****************************************************************
+/* upload pre-compressed image chain */
+void coreTexture::__ModifyCompressed(const coreUint32 iComponents, const coreUint8 iLevels, const coreByte* pChain)
+{
+    ASSERT(m_iIdentifier && m_bCompressed && (iLevels <= m_iLevels) && pChain)
+
+    // calculate compressed size
+    const coreUint32 iWidth      = F_TO_UI(m_vResolution.x);
+    const coreUint32 iHeight     = F_TO_UI(m_vResolution.y);
+    const coreUint32 iPackedSize = (iWidth * iHeight * iComponents) / stb_compress_dxt_ratio(iComponents);
+
+    // check for OpenGL extensions
+    const coreBool bPixelBuffer = CORE_GL_SUPPORT(ARB_pixel_buffer_object) && coreMath::IsAligned(iWidth * iComponents, 4u);
+
+    // bind texture (simple)
+    glBindTexture(GL_TEXTURE_2D, m_iIdentifier);
+    s_apBound[s_iActiveUnit] = NULL;
+
+    // upload all texture levels
+    for(coreUintW i = 0u; i < iLevels; ++i)
+    {
+        const coreUint32 iCurWidth  = iWidth  >> i;
+        const coreUint32 iCurHeight = iHeight >> i;
+        const coreUint32 iCurSize   = iPackedSize >> i >> i;
+
+        coreDataBuffer oBuffer;
+        if(bPixelBuffer) oBuffer.Create(GL_PIXEL_UNPACK_BUFFER, iCurSize, pChain, CORE_DATABUFFER_STORAGE_STREAM);
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, i, 0, 0, iCurWidth, iCurHeight, m_Spec.iFormat, iCurSize, bPixelBuffer ? NULL : pChain);
+
+        pChain += iCurSize;
+    }
+}
+
+
+// ****************************************************************
+/* determine texture mode from load configuration */
+coreTextureMode coreTexture::__GetLoadMode(const coreUint32 iWidth, const coreUint32 iHeight)const
+{
+    return ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NO_COMPRESS) && coreMath::IsPot(iWidth) && coreMath::IsPot(iHeight)) ? CORE_TEXTURE_MODE_COMPRESS : CORE_TEXTURE_MODE_DEFAULT) |
+           ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NO_FILTER))                                                         ? CORE_TEXTURE_MODE_FILTER   : CORE_TEXTURE_MODE_DEFAULT) |
+           ((!HAS_FLAG(m_eLoad, CORE_TEXTURE_LOAD_NEAREST))                                                           ? CORE_TEXTURE_MODE_DEFAULT  : CORE_TEXTURE_MODE_NEAREST);
+}
+
+
+// ****************************************************************
+/* get appropriate compressed texture format (RGTC or S3TC) */
+GLenum coreTexture::__GetCompressedFormat(const GLenum iInternal)
+{
+    switch(iInternal)
+    {
+    default: ASSERT(false)
+    case GL_LUMINANCE8:
+    case GL_R8:    if(CORE_GL_SUPPORT(ARB_texture_compression_rgtc)) return GL_COMPRESSED_RED_RGTC1;          break;
+    case GL_RG8:   if(CORE_GL_SUPPORT(ARB_texture_compression_rgtc)) return GL_COMPRESSED_RG_RGTC2;           break;
+    case GL_RGB8:  if(CORE_GL_SUPPORT(EXT_texture_compression_s3tc)) return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;  break;
+    case GL_RGBA8: if(CORE_GL_SUPPORT(EXT_texture_compression_s3tc)) return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+    }
+
+    return 0u;
+}
+
+
 // ****************************************************************
 /* bind texture to texture unit */
 void coreTexture::__BindTexture(const coreUintW iUnit, coreTexture* pTexture)
@@ -114,6 +114,10 @@ private:
 
     coreSync m_Sync;                                     // sync object for asynchronous texture loading
 
+    SDL_Surface* m_pDecodeSurface;                       // decoded plain pixel data (waiting for upload)
+    coreByte*    m_pDecodeChain;                         // pre-compressed image chain with all required levels (waiting for upload)
+    coreUint8    m_iDecodeLevels;                        // number of levels within the pre-compressed image chain
+
     static coreUintW    s_iActiveUnit;                   // active texture unit
     static coreTexture* s_apBound[CORE_TEXTURE_UNITS];   // texture objects currently associated with texture units
 
@@ -128,6 +132,13 @@ public:
     coreStatus Load(coreFile* pFile)final;
     coreStatus Unload()final;
 
+    /* decode texture resource data (without graphics context) */
+    coreStatus      Decode     (coreFile* pFile)final;
+    inline coreBool IsDecodable()const final {return (!m_iIdentifier && !m_pDecodeSurface);}
+
+    /* get estimated memory usage */
+    coreUintW GetMemorySize()const final;
+
     /* handle texture memory */
     void Create(const coreUint32 iWidth, const coreUint32 iHeight, const coreTextureSpec& oSpec, const coreTextureMode eMode);
     void Modify(const coreUint32 iOffsetX, const coreUint32 iOffsetY, const coreUint32 iWidth, const coreUint32 iHeight, const coreUint32 iDataSize, const coreByte* pData);
@@ -154,8 +165,9 @@ public:
     coreStatus Invalidate(const coreUint8 iLevel);
 
     /* process and convert image data */
-    static FUNC_NOALIAS void CreateNextLevel (const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput);
-    static              void CreateCompressed(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput);
+    static FUNC_NOALIAS    void      CreateNextLevel      (const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput);
+    static                 void      CreateCompressed     (const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreByte* pInput, coreByte* OUTPUT pOutput);
+    static RETURN_RESTRICT coreByte* CreateCompressedChain(const coreUintW iInWidth, const coreUintW iInHeight, const coreUintW iComponents, const coreUintW iLevels, const coreByte* pInput);
 
     /* get object properties */
     inline const GLuint&          GetIdentifier()const {return m_iIdentifier;}
@@ -166,6 +178,13 @@ public:
 
 
 private:
+    /* upload pre-compressed image chain */
+    void __ModifyCompressed(const coreUint32 iComponents, const coreUint8 iLevels, const coreByte* pChain);
+
+    /* resolve texture properties */
+    coreTextureMode __GetLoadMode(const coreUint32 iWidth, const coreUint32 iHeight)const;
+    static GLenum   __GetCompressedFormat(const GLenum iInternal);
+
     /* bind texture to texture unit */
     static void __BindTexture(const coreUintW iUnit, coreTexture* pTexture);
 };
@@ -12,16 +12,29 @@
 // ****************************************************************
 /* constructor */
 coreThread::coreThread(const coreChar* pcName)noexcept
-: m_pThread      (NULL)
-, m_sName        (pcName)
-, m_fFrequency   (0.0f)
-, m_bActive      (false)
-, m_anFuncNew    {}
-, m_anFuncActive {}
-, m_LockNew      ()
-, m_LockActive   ()
-, m_iTokenCount  (0u)
+: m_pThread        (NULL)
+, m_sName          (pcName)
+, m_fFrequency     (0.0f)
+, m_bActive        (false)
+, m_fIdleTimeout   (0.0f)
+, m_bWakeSignal    (false)
+, m_pWakeMutex     (SDL_CreateMutex())
+, m_pWakeCond      (SDL_CreateCond())
+, m_aFuncQueue     {}
+, m_iQueueTail     (0u)
+, m_iQueueHead     (0u)
+, m_anFuncOverflow {}
+, m_iOverflowNum   (0u)
+, m_LockOverflow   ()
+, m_anFuncActive   {}
+, m_LockActive     ()
+, m_iTokenCount    (0u)
 {
+    // record lock statistics (only in lock statistics mode)
+    m_LockActive.SetName("thread_function");
+
+    // prepare all queue slots (each one expects its own position first)
+    for(coreUintW i = 0u; i < CORE_THREAD_QUEUE_SIZE; ++i) m_aFuncQueue[i].iSequence.store(i, std::memory_order::relaxed);
 }
 
 
@@ -32,9 +45,14 @@ coreThread::~coreThread()
     // kill the thread
     this->KillThread();
 
+    // delete wake-up objects
+    SDL_DestroyCond (m_pWakeCond);
+    SDL_DestroyMutex(m_pWakeMutex);
+
     // clear memory
-    m_anFuncNew   .clear();
-    m_anFuncActive.clear();
+    for(coreUintW i = 0u; i < CORE_THREAD_QUEUE_SIZE; ++i) m_aFuncQueue[i].oFunc.Clear();
+    m_anFuncOverflow.clear();
+    m_anFuncActive  .clear();
 }
 
 
@@ -68,6 +86,7 @@ void coreThread::KillThread()
     {
         // signal thread to shut down
         m_bActive = false;
+        this->WakeUp();
 
         // wait for thread to finish
         SDL_WaitThread(m_pThread, NULL);
@@ -80,30 +99,44 @@ void coreThread::KillThread()
 /* detach custom function */
 coreBool coreThread::DetachFunction(const coreUint32 iToken)
 {
-    if(!m_anFuncNew.empty())
     {
-        coreSpinLocker oLocker(&m_LockNew);
+        // prevent collection in the meantime (but not execution, to allow detaching from within custom functions)
+        coreSpinLocker oLocker(&m_LockOverflow);
 
-        // search through new custom functions
-        FOR_EACH(it, m_anFuncNew)
+        // search through all filled queue slots
+        for(coreUintW i = m_iQueueHead, ie = m_iQueueTail.load(std::memory_order::acquire); i < ie; ++i)
         {
-            if(it->iToken == iToken)
+            coreFuncSlot& oSlot = m_aFuncQueue[i & (CORE_THREAD_QUEUE_SIZE - 1u)];
+
+            if((oSlot.iSequence.load(std::memory_order::acquire) == i + 1u) && (oSlot.oFunc.GetToken() == iToken) && !oSlot.bDetached)
+            {
+                // mark function to be skipped during collection
+                oSlot.bDetached = true;
+                return true;
+            }
+        }
+
+        // search through overflowing custom functions
+        FOR_EACH(it, m_anFuncOverflow)
+        {
+            if(it->GetToken() == iToken)
             {
                 // remove function from list
-                m_anFuncNew.erase(it);
+                m_anFuncOverflow.erase(it);
+                m_iOverflowNum.FetchSub(1u);
                 return true;
             }
         }
     }
 
-    if(!m_anFuncActive.empty())
     {
+        // prevent collection and execution in the meantime (functions collected after the previous search are found here)
         coreSpinLocker oLocker(&m_LockActive);
 
         // search through active custom functions
         FOR_EACH(it, m_anFuncActive)
         {
-            if(it->iToken == iToken)
+            if(it->GetToken() == iToken)
             {
                 // remove function from list
                 m_anFuncActive.erase(it);
@@ -122,25 +155,35 @@ void coreThread::UpdateFunctions()
 {
     coreSpinLocker oLocker(&m_LockActive);
 
-    if(!m_anFuncNew.empty())
-    {
-        coreSpinLocker oLocker2(&m_LockNew);
-
-        // collect new custom functions
-        FOR_EACH(it, m_anFuncNew) m_anFuncActive.push_back(std::move(*it));
-        m_anFuncNew.clear();
-    }
+    // collect new custom functions
+    this->__CollectFunctions();
 
     // loop trough all functions
     FOR_EACH_DYN(it, m_anFuncActive)
     {
         // call function and remove when successful
-        if(it->nFunction()) DYN_KEEP  (it)
-                       else DYN_REMOVE(it, m_anFuncActive)
+        if((*it)()) DYN_KEEP  (it)
+               else DYN_REMOVE(it, m_anFuncActive)
     }
 }
 
 
+// ****************************************************************
+/* wake up the thread when sleeping */
+void coreThread::WakeUp()
+{
+    // only for event-driven threads (always signal under the mutex, to not miss a thread going to sleep)
+    if(!m_fIdleTimeout) return;
+
+    SDL_LockMutex(m_pWakeMutex);
+    {
+        m_bWakeSignal = true;
+        SDL_CondSignal(m_pWakeCond);
+    }
+    SDL_UnlockMutex(m_pWakeMutex);
+}
+
+
 // ****************************************************************
 /* execute the thread */
 coreStatus coreThread::__Main()
@@ -156,19 +199,32 @@ coreStatus coreThread::__Main()
     // begin main-loop
     while(eReturn == CORE_OK)
     {
-        if(m_fFrequency)
+        if(m_fIdleTimeout && !this->__HasFunctions() && this->__IsThreadIdle())
+        {
+            // sleep without work until woken up (or timed out)
+            this->__WaitWakeUp(F_TO_UI(m_fIdleTimeout * 1000.0f));
+
+            // restart frequency handling
+            iAfterTime = SDL_GetPerformanceCounter();
+            dWait      = 0.0;
+        }
+        else if(m_fFrequency)
         {
             // handle thread-overhead
             iBeforeTime = SDL_GetPerformanceCounter();
             dWait      -= coreDouble(iBeforeTime - iAfterTime) * Core::System->GetPerfFrequency();
 
-            // wait for next iteration
+            // wait for next iteration (can be woken up earlier, when event-driven)
             dWait = MAX(dWait + (1.0 / coreDouble(m_fFrequency)), 0.0);
-            SDL_Delay(F_TO_UI(dWait * 1000.0));
+            if(m_fIdleTimeout) this->__WaitWakeUp(F_TO_UI(dWait * 1000.0));
+                          else SDL_Delay     (F_TO_UI(dWait * 1000.0));
 
             // handle rounding-errors
             iAfterTime = SDL_GetPerformanceCounter();
             dWait     -= coreDouble(iAfterTime - iBeforeTime) * Core::System->GetPerfFrequency();
+
+            // drop remaining wait-time when woken up earlier (would accumulate otherwise)
+            if(m_fIdleTimeout) dWait = MIN(dWait, 0.0);
         }
         else
         {
@@ -195,6 +251,20 @@ coreStatus coreThread::__Main()
 }
 
 
+// ****************************************************************
+/* sleep until woken up or timed out */
+void coreThread::__WaitWakeUp(const coreUint32 iTimeout)
+{
+    SDL_LockMutex(m_pWakeMutex);
+    {
+        // skip sleeping when already requested or shutting down
+        if(!m_bWakeSignal && m_bActive) SDL_CondWaitTimeout(m_pWakeCond, m_pWakeMutex, iTimeout);
+        m_bWakeSignal = false;
+    }
+    SDL_UnlockMutex(m_pWakeMutex);
+}
+
+
 // ****************************************************************
 /* entry-point function */
 coreInt32 SDLCALL coreThreadMain(void* pData)
@@ -209,4 +279,145 @@ coreInt32 SDLCALL coreThreadMain(void* pData)
 
     // execute the thread
     return pThread->__Main();
-}
\ No newline at end of file
+}
+
+
+// ****************************************************************
+/* add new custom function (lock-free, as long as the queue is not full) */
+void coreThread::__PushFunction(coreCustomFunc&& oFunc)
+{
+    coreUintW iPos = m_iQueueTail.load(std::memory_order::relaxed);
+
+    // keep using the overflow list until it was collected (the queue is always collected first, which would change the order)
+    while(!m_iOverflowNum)
+    {
+        coreFuncSlot& oSlot = m_aFuncQueue[iPos & (CORE_THREAD_QUEUE_SIZE - 1u)];
+
+        const coreUintW iSequence = oSlot.iSequence.load(std::memory_order::acquire);
+        const coreIntW  iDiff     = coreIntW(iSequence) - coreIntW(iPos);
+
+        if(iDiff == 0)
+        {
+            // try to reserve the free slot
+            if(m_iQueueTail.compare_exchange_weak(iPos, iPos + 1u, std::memory_order::relaxed))
+            {
+                oSlot.oFunc     = std::move(oFunc);
+                oSlot.bDetached = false;
+
+                // publish the filled slot to the consumer
+                oSlot.iSequence.store(iPos + 1u, std::memory_order::release);
+                return;
+            }
+        }
+        else if(iDiff < 0)
+        {
+            // queue is full, use the overflow list instead (without waiting on the consumer, which may be the current thread)
+            break;
+        }
+        else
+        {
+            // slot was taken by another producer
+            iPos = m_iQueueTail.load(std::memory_order::relaxed);
+        }
+    }
+
+    coreSpinLocker oLocker(&m_LockOverflow);
+
+    // add to the overflow list
+    m_anFuncOverflow.push_back(std::move(oFunc));
+    m_iOverflowNum.FetchAdd(1u);
+}
+
+
+// ****************************************************************
+/* move new custom functions into the active list (consumer only) */
+void coreThread::__CollectFunctions()
+{
+    ASSERT(m_LockActive.IsLocked())
+
+    // skip without new custom functions
+    if((m_iQueueTail.load(std::memory_order::relaxed) == m_iQueueHead) && !m_iOverflowNum) return;
+
+    // prevent detaching in the meantime
+    coreSpinLocker oLocker(&m_LockOverflow);
+
+    while(true)
+    {
+        coreFuncSlot& oSlot = m_aFuncQueue[m_iQueueHead & (CORE_THREAD_QUEUE_SIZE - 1u)];
+
+        // stop at the first slot not published yet
+        if(oSlot.iSequence.load(std::memory_order::acquire) != m_iQueueHead + 1u) break;
+
+        // take function from the slot (skip when detached)
+        if(!oSlot.bDetached) m_anFuncActive.push_back(std::move(oSlot.oFunc));
+        oSlot.oFunc.Clear();
+
+        // release the slot for the next round
+        oSlot.iSequence.store(m_iQueueHead + CORE_THREAD_QUEUE_SIZE, std::memory_order::release);
+        m_iQueueHead += 1u;
+    }
+
+    // collect overflowing custom functions (always attached after all functions in the queue)
+    FOR_EACH(it, m_anFuncOverflow) m_anFuncActive.push_back(std::move(*it));
+    m_anFuncOverflow.clear();
+    m_iOverflowNum = 0u;
+}
+
+
+// ****************************************************************
+/* check for any new or active custom functions */
+coreBool coreThread::__HasFunctions()const
+{
+    return !m_anFuncActive.empty() || (m_iQueueTail.load(std::memory_order::relaxed) != m_iQueueHead) || m_iOverflowNum;
+}
+
+
+// ****************************************************************
+/* move constructor */
+coreThread::coreCustomFunc::coreCustomFunc(coreCustomFunc&& m)noexcept
+: m_aStorage {}
+, m_nInvoke  (m.m_nInvoke)
+, m_nManage  (m.m_nManage)
+, m_iToken   (m.m_iToken)
+{
+    // move the stored callable
+    if(m_nManage) m_nManage(m.m_aStorage, m_aStorage);
+
+    m.m_nInvoke = NULL;
+    m.m_nManage = NULL;
+}
+
+
+// ****************************************************************
+/* assignment operations */
+coreThread::coreCustomFunc& coreThread::coreCustomFunc::operator = (coreCustomFunc&& m)noexcept
+{
+    if(this != &m)
+    {
+        // destroy own callable
+        this->Clear();
+
+        // move the stored callable
+        if(m.m_nManage) m.m_nManage(m.m_aStorage, m_aStorage);
+
+        m_nInvoke = m.m_nInvoke;
+        m_nManage = m.m_nManage;
+        m_iToken  = m.m_iToken;
+
+        m.m_nInvoke = NULL;
+        m.m_nManage = NULL;
+    }
+
+    return *this;
+}
+
+
+// ****************************************************************
+/* destroy the stored callable */
+void coreThread::coreCustomFunc::Clear()
+{
+    if(m_nManage) m_nManage(m_aStorage, NULL);
+
+    m_nInvoke = NULL;
+    m_nManage = NULL;
+}
@@ -11,32 +11,80 @@
 #define _CORE_GUARD_THREAD_H_
 
 
+// ****************************************************************
+/* thread definitions */
+#define CORE_THREAD_QUEUE_SIZE   (128u)   // number of slots in the lock-free queue for new custom functions (power of two)
+#define CORE_THREAD_FUNC_STORAGE (48u)    // size of the inline storage for custom functions (bigger ones are allocated on the heap)
+
+
 // ****************************************************************
 /* thread interface */
 class INTERFACE coreThread
 {
 private:
-    /* custom function structure */
-    struct coreCustomFunc final
+    /* custom function class (type-erased, with small-buffer storage) */
+    class coreCustomFunc final
     {
-        std::function<coreStatus()> nFunction;   // actual function to execute
-        coreUint32                  iToken;      // unique token as identifier
+    private:
+        alignas(ALIGNMENT_NEW) coreByte m_aStorage[CORE_THREAD_FUNC_STORAGE];   // inline storage of the callable (or pointer to the heap)
+
+        coreStatus (*m_nInvoke)(void*);                                         // call the stored callable
+        void       (*m_nManage)(void*, void*);                                  // move the stored callable into another storage (or destroy it, without target)
+
+        coreUint32 m_iToken;                                                    // unique token as identifier
+
+
+    public:
+        coreCustomFunc()noexcept : m_aStorage {}, m_nInvoke (NULL), m_nManage (NULL), m_iToken (0u) {}
+        template <typename F> coreCustomFunc(F&& nFunction, const coreUint32 iToken)noexcept;
+        ~coreCustomFunc() {this->Clear();}
+
+        coreCustomFunc(coreCustomFunc&& m)noexcept;
+        coreCustomFunc& operator = (coreCustomFunc&& m)noexcept;
+
+        /* call the stored callable */
+        inline coreStatus operator () () {ASSERT(m_nInvoke) return m_nInvoke(m_aStorage);}
+
+        /* destroy the stored callable */
+        void Clear();
+
+        /* get object properties */
+        inline const coreUint32& GetToken()const {return m_iToken;}
+    };
+
+    /* queue slot structure */
+    struct coreFuncSlot final
+    {
+        std::atomic<coreUintW> iSequence;   // current sequence number (determines whether the slot is free or filled)
+        coreCustomFunc         oFunc;       // stored custom function
+        coreBool               bDetached;   // function was detached before it could be collected
     };
 
 
 private:
-    SDL_Thread* m_pThread;                     // pointer to thread structure
-    coreString  m_sName;                       // name of the thread
+    SDL_Thread* m_pThread;                                         // pointer to thread structure
+    coreString  m_sName;                                           // name of the thread
+
+    coreFloat m_fFrequency;                                        // average number of iterations per second (0.0f = ignore)
+    coreBool  m_bActive;                                           // currently active and not forced to shut down
 
-    coreFloat m_fFrequency;                    // average number of iterations per second (0.0f = ignore)
-    coreBool  m_bActive;                       // currently active and not forced to shut down
+    coreFloat            m_fIdleTimeout;                           // max time (in seconds) to sleep while idle, until woken up (0.0f = always poll with frequency)
+    coreBool             m_bWakeSignal;                            // wake-up requested (e.g. new work available, protected by the mutex)
+    SDL_mutex*           m_pWakeMutex;                             // mutex for the wake-up condition
+    SDL_cond*            m_pWakeCond;                              // condition variable to wake up the sleeping thread
 
-    coreList<coreCustomFunc> m_anFuncNew;      // new custom functions (separate, to allow attaching and executing at the same time)
-    coreList<coreCustomFunc> m_anFuncActive;   // active custom functions
-    coreSpinLock m_LockNew;                    // spinlock for collecting new functions
-    coreSpinLock m_LockActive;                 // spinlock for executing active functions
+    coreFuncSlot           m_aFuncQueue[CORE_THREAD_QUEUE_SIZE];   // lock-free queue with new custom functions (multi-producer, single-consumer)
+    std::atomic<coreUintW> m_iQueueTail;                           // next queue position to fill (shared by all producers)
+    coreUintW              m_iQueueHead;                           // next queue position to collect (only changed by the consumer, while collecting)
 
-    coreUint32 m_iTokenCount;                  // number of assigned function tokens
+    coreList<coreCustomFunc> m_anFuncOverflow;                     // new custom functions, while the queue is full (and until collected, to keep their order)
+    coreAtomic<coreUint32>   m_iOverflowNum;                       // number of overflowing custom functions (for fast checks)
+    coreSpinLock             m_LockOverflow;                       // spinlock for collecting and detaching new functions (queue and overflow)
+
+    coreList<coreCustomFunc> m_anFuncActive;                       // active custom functions
+    coreSpinLock             m_LockActive;                         // spinlock for executing active functions (and collecting new ones)
+
+    coreAtomic<coreUint32> m_iTokenCount;                          // number of assigned function tokens
 
 
 public:
@@ -54,13 +102,18 @@ public:
     coreBool DetachFunction(const coreUint32 iToken);
     void     UpdateFunctions();
 
+    /* wake up the thread when sleeping (event-driven) */
+    void WakeUp();
+
     /* set object properties */
-    inline void SetFrequency(const coreFloat fFrequency) {m_fFrequency = fFrequency;}
+    inline void SetFrequency  (const coreFloat fFrequency) {m_fFrequency   = fFrequency;}
+    inline void SetIdleTimeout(const coreFloat fTimeout)   {m_fIdleTimeout = fTimeout;}
 
     /* get object properties */
-    inline const coreChar*  GetName     ()const {return m_sName.c_str();}
-    inline const coreFloat& GetFrequency()const {return m_fFrequency;}
-    inline const coreBool&  GetActive   ()const {return m_bActive;}
+    inline const coreChar*  GetName       ()const {return m_sName.c_str();}
+    inline const coreFloat& GetFrequency  ()const {return m_fFrequency;}
+    inline const coreFloat& GetIdleTimeout()const {return m_fIdleTimeout;}
+    inline const coreBool&  GetActive     ()const {return m_bActive;}
 
 
 private:
@@ -70,6 +123,17 @@ private:
     virtual coreStatus __RunThread () = 0;
     virtual void       __ExitThread() = 0;
 
+    /* check for missing work (to sleep until woken up) */
+    virtual coreBool __IsThreadIdle()const {return true;}
+
+    /* handle new custom functions */
+    void     __PushFunction    (coreCustomFunc&& oFunc);
+    void     __CollectFunctions();
+    coreBool __HasFunctions    ()const;
+
+    /* sleep until woken up or timed out */
+    void __WaitWakeUp(const coreUint32 iTimeout);
+
     /* entry-point function */
     friend coreInt32 SDLCALL coreThreadMain(void* pData);
 };
@@ -79,21 +143,56 @@ private:
 /* attach custom function */
 template <typename F> coreUint32 coreThread::AttachFunction(F&& nFunction)
 {
-    coreSpinLocker oLocker(&m_LockNew);
-
     // get unique token
-    const coreUint32 iToken = (++m_iTokenCount);
+    const coreUint32 iToken = m_iTokenCount.AddFetch(1u);
 
-    // create new custom function
-    coreCustomFunc oFunc;
-    oFunc.nFunction = nFunction;
-    oFunc.iToken    = iToken;
+    // create and add new custom function (without lock)
+    this->__PushFunction(coreCustomFunc(std::forward<F>(nFunction), iToken));
 
-    // add function to list
-    m_anFuncNew.push_back(std::move(oFunc));
+    // execute as soon as possible
+    this->WakeUp();
 
     return iToken;
 }
 
 
+// ****************************************************************
+/* constructor */
+template <typename F> coreThread::coreCustomFunc::coreCustomFunc(F&& nFunction, const coreUint32 iToken)noexcept
+: m_aStorage {}
+, m_nInvoke  (NULL)
+, m_nManage  (NULL)
+, m_iToken   (iToken)
+{
+    using T = std::decay_t<F>;
+
+    if constexpr((sizeof(T) <= CORE_THREAD_FUNC_STORAGE) && (alignof(T) <= ALIGNMENT_NEW) && std::is_nothrow_move_constructible_v<T>)
+    {
+        // store callable directly
+        new(m_aStorage) T(std::forward<F>(nFunction));
+
+        m_nInvoke = [](void* pStorage) -> coreStatus {return (*std::launder(s_cast<T*>(pStorage)))();};
+        m_nManage = [](void* pStorage, void* pTarget)
+        {
+            T* pFunction = std::launder(s_cast<T*>(pStorage));
+            if(pTarget) new(pTarget) T(std::move(*pFunction));
+            pFunction->~T();
+        };
+    }
+    else
+    {
+        // store pointer to callable (too big for the inline storage)
+        T* pFunction = new T(std::forward<F>(nFunction));
+        std::memcpy(m_aStorage, &pFunction, sizeof(T*));
+
+        m_nInvoke = [](void* pStorage) -> coreStatus {return (**s_cast<T**>(pStorage))();};
+        m_nManage = [](void* pStorage, void* pTarget)
+        {
+            if(pTarget) std::memcpy(pTarget, pStorage, sizeof(T*));
+                   else delete (*s_cast<T**>(pStorage));
+        };
+    }
+}
+
+
 #endif /* _CORE_GUARD_THREAD_H_ */
\ No newline at end of file
@@ -0,0 +1,219 @@
+///////////////////////////////////////////////////////////
+//*-----------------------------------------------------*//
+//| Part of the Core Engine (https://www.maus-games.at) |//
+//*-----------------------------------------------------*//
+//| Copyright (c) 2013 Martin Mauersics                 |//
+//| Released under the zlib License                     |//
+//*-----------------------------------------------------*//
+///////////////////////////////////////////////////////////
+#include "Core.h"
+
+thread_local coreUintW coreJobManager::s_iQueue = CORE_JOB_EXTERN;
+
+
+// ****************************************************************
+/* constructor */
+coreJobCounter::coreJobCounter()noexcept
+: m_iCount        (0u)
+, m_aContinuation {}
+, m_Lock          ()
+{
+}
+
+
+// ****************************************************************
+/* destructor */
+coreJobCounter::~coreJobCounter()
+{
+    ASSERT(this->IsDone() && m_aContinuation.empty())
+
+    // wait for the last finishing thread to leave
+    coreSpinLocker oLocker(&m_Lock);
+}
+
+
+// ****************************************************************
+/* constructor */
+coreJobManager::coreJobManager()noexcept
+: m_apWorker   {}
+, m_aQueue     {}
+, m_iPending   (0u)
+, m_iWakeIndex (0u)
+, m_bActive    (false)
+{
+    // record lock statistics (only in lock statistics mode)
+    for(coreUintW i = 0u; i < ARRAY_SIZE(m_aQueue); ++i) m_aQueue[i].Lock.SetName("job_queue");
+
+    // create job worker threads (use all remaining cores)
+    const coreUintW iWorkers = CLAMP(SDL_GetCPUCount() - 1, 1, coreInt32(CORE_JOB_WORKERS));
+    for(coreUintW i = 0u; i < iWorkers; ++i) m_apWorker.push_back(MANAGED_NEW(coreJobWorker, i + 1u));
+
+    // start all threads, but only use them if at least one is running
+    FOR_EACH(it, m_apWorker) if((*it)->StartThread()) m_bActive = true;
+
+    Core::Log->Info(CORE_LOG_BOLD("Job Manager created") " (%zu worker threads)", m_apWorker.size());
+}
+
+
+// ****************************************************************
+/* destructor */
+coreJobManager::~coreJobManager()
+{
+    // finish all remaining jobs
+    while(this->__ExecuteJob()) {}
+
+    // delete job worker threads
+    FOR_EACH(it, m_apWorker) MANAGED_DELETE(*it)
+
+    // clear memory
+    m_apWorker.clear();
+
+    Core::Log->Info(CORE_LOG_BOLD("Job Manager destroyed"));
+}
+
+
+// ****************************************************************
+/* submit new job */
+void coreJobManager::Submit(std::function<void()> nFunction, coreJobCounter* pCounter, coreJobCounter* pDependency)
+{
+    ASSERT(nFunction && (pCounter != pDependency))
+
+    // execute directly without job worker threads
+    if(!m_bActive)
+    {
+        ASSERT(!pDependency || pDependency->IsDone())
+        nFunction();
+        return;
+    }
+
+    // register with the counter (before the job can be finished)
+    if(pCounter) pCounter->m_iCount.fetch_add(1u, std::memory_order::relaxed);
+
+    // create new job
+    coreJob oJob;
+    oJob.nFunction = std::move(nFunction);
+    oJob.pCounter  = pCounter;
+
+    if(pDependency)
+    {
+        coreSpinLocker oLocker(&pDependency->m_Lock);
+
+        // delay until all jobs of the dependency are finished
+        if(!pDependency->IsDone())
+        {
+            pDependency->m_aContinuation.push_back(std::move(oJob));
+            return;
+        }
+    }
+
+    // add job to own queue
+    this->__PushJob(std::move(oJob));
+}
+
+
+// ****************************************************************
+/* wait for finished jobs (and help executing) */
+void coreJobManager::Wait(const coreJobCounter* pCounter)
+{
+    ASSERT(pCounter)
+
+    // execute jobs from all queues, until the counter is done
+    while(!pCounter->IsDone())
+    {
+        if(!this->__ExecuteJob()) CORE_SPINLOCK_YIELD
+    }
+}
+
+
+// ****************************************************************
+/* add job to the queue of the current thread */
+void coreJobManager::__PushJob(coreJob&& oJob)
+{
+    coreJobQueue& oQueue = m_aQueue[s_iQueue];
+
+    // add job to the back
+    oQueue.Lock.Lock();
+    {
+        oQueue.aJob.push_back(std::move(oJob));
+    }
+    oQueue.Lock.Unlock();
+
+    // wake up next job worker thread
+    m_iPending.FetchAdd(1u);
+    m_apWorker[m_iWakeIndex.FetchAdd(1u) % m_apWorker.size()]->WakeUp();
+}
+
+
+// ****************************************************************
+/* execute next job (own newest job first, otherwise steal oldest job from other threads) */
+coreBool coreJobManager::__ExecuteJob()
+{
+    if(!m_iPending) return false;
+
+    const coreUintW iOwn = s_iQueue;
+    const coreUintW iNum = m_apWorker.size() + 1u;
+
+    coreJob  oJob;
+    coreBool bFound = false;
+
+    // search all queues, starting with the own one
+    for(coreUintW i = 0u; (i < iNum) && !bFound; ++i)
+    {
+        coreJobQueue& oQueue = m_aQueue[(iOwn + i) % iNum];
+
+        coreSpinLocker oLocker(&oQueue.Lock);
+        if(oQueue.aJob.empty()) continue;
+
+        if(i)
+        {
+            // steal from the front
+            oJob = std::move(oQueue.aJob.front());
+            oQueue.aJob.pop_front();
+        }
+        else
+        {
+            // take from the back
+            oJob = std::move(oQueue.aJob.back());
+            oQueue.aJob.pop_back();
+        }
+
+        bFound = true;
+    }
+    if(!bFound) return false;
+
+    m_iPending.FetchSub(1u);
+
+    // execute job
+    oJob.nFunction();
+    if(oJob.pCounter) this->__FinishJob(oJob.pCounter);
+
+    return true;
+}
+
+
+// ****************************************************************
+/* decrease job counter and submit its continuations */
+void coreJobManager::__FinishJob(coreJobCounter* pCounter)
+{
+    ASSERT(pCounter->GetCount())
+
+    // decrease without lock, as long as other jobs are still running
+    coreUint32 iCount = pCounter->m_iCount.load(std::memory_order::relaxed);
+    while(iCount > 1u)
+    {
+        if(pCounter->m_iCount.compare_exchange_weak(iCount, iCount - 1u, std::memory_order::acq_rel, std::memory_order::relaxed)) return;
+    }
+
+    coreList<coreJob> aContinuation;
+
+    // finish the last job together with taking all continuations (counter may be destroyed afterwards)
+    pCounter->m_Lock.Lock();
+    {
+        aContinuation.swap(pCounter->m_aContinuation);
+        pCounter->m_iCount.fetch_sub(1u, std::memory_order::acq_rel);
+    }
+    pCounter->m_Lock.Unlock();
+
+    // submit all delayed jobs
+    FOR_EACH(it, aContinuation) this->__PushJob(std::move(*it));
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////
+//*-----------------------------------------------------*//
+//| Part of the Core Engine (https://www.maus-games.at) |//
+//*-----------------------------------------------------*//
+//| Copyright (c) 2013 Martin Mauersics                 |//
+//| Released under the zlib License                     |//
+//*-----------------------------------------------------*//
+///////////////////////////////////////////////////////////
+#pragma once
+#ifndef _CORE_GUARD_JOB_H_
+#define _CORE_GUARD_JOB_H_
+
+// TODO 3: lock-free work-stealing deques (Chase-Lev), instead of spinlock-protected queues
+// TODO 3: avoid heap-allocation of bigger job functions (custom small-buffer storage)
+// TODO 4: wake up only idle job worker threads, instead of round-robin
+
+
+// ****************************************************************
+/* job definitions */
+#define CORE_JOB_WORKERS (32u)    // max number of job worker threads
+#define CORE_JOB_IDLE    (0.5f)   // max time (in seconds) to sleep without jobs, until woken up
+#define CORE_JOB_CHUNKS  (4u)     // max number of chunks per thread created by a parallel-for
+#define CORE_JOB_EXTERN  (0u)     // queue index used by all threads not owned by the job manager (e.g. main-thread)
+
+class coreJobCounter;
+
+
+// ****************************************************************
+/* job structure */
+struct coreJob final
+{
+    std::function<void()> nFunction;   // actual function to execute
+    coreJobCounter*       pCounter;    // counter to decrease when finished (optional)
+};
+
+
+// ****************************************************************
+/* job counter class */
+class coreJobCounter final
+{
+private:
+    std::atomic<coreUint32> m_iCount;          // number of unfinished jobs
+    coreList<coreJob>       m_aContinuation;   // jobs to submit after all jobs are finished
+    coreSpinLock            m_Lock;            // spinlock to prevent invalid continuation access
+
+
+public:
+    coreJobCounter()noexcept;
+    ~coreJobCounter();
+
+    FRIEND_CLASS(coreJobManager)
+    DISABLE_COPY(coreJobCounter)
+
+    /* check for finished jobs */
+    inline coreBool   IsDone  ()const {return !m_iCount.load(std::memory_order::acquire);}
+    inline coreUint32 GetCount()const {return  m_iCount.load(std::memory_order::relaxed);}
+};
+
+
+// ****************************************************************
+/* job manager */
+class coreJobManager final
+{
+private:
+    /* job worker thread */
+    class coreJobWorker final : public coreThread
+    {
+    private:
+        coreUintW m_iIndex;   // own queue index
+
+
+    public:
+        explicit coreJobWorker(const coreUintW iIndex)noexcept : coreThread ("job_worker"), m_iIndex (iIndex) {this->SetIdleTimeout(CORE_JOB_IDLE);}
+
+        DISABLE_COPY(coreJobWorker)
+
+
+    private:
+        /* job worker implementations */
+        inline coreStatus __InitThread()final {coreJobManager::s_iQueue = m_iIndex; return CORE_OK;}
+        inline coreStatus __RunThread ()final {while(Core::Manager::Job->__ExecuteJob()) {} return CORE_OK;}
+        inline void       __ExitThread()final {}
+
+        /* check for missing jobs */
+        inline coreBool __IsThreadIdle()const final {return !Core::Manager::Job->m_iPending;}
+    };
+
+    /* job queue structure */
+    struct alignas(ALIGNMENT_CACHE) coreJobQueue final
+    {
+        std::deque<coreJob> aJob;   // waiting jobs (owner works at the back, other threads steal from the front)
+        coreSpinLock        Lock;   // spinlock to prevent invalid queue access
+    };
+
+
+private:
+    coreList<coreJobWorker*> m_apWorker;                        // job worker threads
+    coreJobQueue             m_aQueue[CORE_JOB_WORKERS + 1u];   // job queues (one per job worker thread, plus one for all other threads)
+
+    coreAtomic<coreUint32> m_iPending;                          // number of waiting jobs (for fast idle-checks)
+    coreAtomic<coreUint32> m_iWakeIndex;                        // next job worker thread to wake up
+
+    coreBool m_bActive;                                         // job worker threads are running (otherwise execute jobs immediately)
+
+    static thread_local coreUintW s_iQueue;                     // queue index of the current thread
+
+
+private:
+    coreJobManager()noexcept;
+    ~coreJobManager();
+
+
+public:
+    FRIEND_CLASS(Core)
+    DISABLE_COPY(coreJobManager)
+
+    /* submit new job */
+    void Submit(std::function<void()> nFunction, coreJobCounter* pCounter = NULL, coreJobCounter* pDependency = NULL);   // [](void) -> void
+
+    /* wait for finished jobs (and help executing) */
+    void Wait(const coreJobCounter* pCounter);
+
+    /* execute function for each index in parallel */
+    template <typename F> void ParallelFor(const coreUintW iNum, const coreUintW iGrain, F&& nFunction);   // [](const coreUintW i) -> void
+
+    /* get manager properties */
+    inline coreUintW GetNumWorkers()const {return m_apWorker.size();}
+
+
+private:
+    /* handle jobs */
+    void     __PushJob   (coreJob&& oJob);
+    coreBool __ExecuteJob();
+    void     __FinishJob (coreJobCounter* pCounter);
+};
+
+
+// ****************************************************************
+/* execute function for each index in parallel */
+template <typename F> void coreJobManager::ParallelFor(const coreUintW iNum, const coreUintW iGrain, F&& nFunction)
+{
+    ASSERT(iGrain)
+
+    // execute directly when not worth splitting
+    if((iNum <= iGrain) || !m_bActive)
+    {
+        for(coreUintW i = 0u; i < iNum; ++i) nFunction(i);
+        return;
+    }
+
+    // split range into chunks (at least grain-sized, with a limited number per thread)
+    const coreUintW iChunks = MIN((iNum + iGrain - 1u) / iGrain, (m_apWorker.size() + 1u) * CORE_JOB_CHUNKS);
+    const coreUintW iStep   = (iNum + iChunks - 1u) / iChunks;
+
+    coreJobCounter oCounter;
+
+    // submit all but the first chunk
+    for(coreUintW i = iStep; i < iNum; i += iStep)
+    {
+        const coreUintW iFrom = i;
+        const coreUintW iTo   = MIN(i + iStep, iNum);
+
+        this->Submit([&nFunction, iFrom, iTo]()
+        {
+            for(coreUintW j = iFrom; j < iTo; ++j) nFunction(j);
+        },
+        &oCounter);
+    }
+
+    // execute first chunk on the calling thread
+    for(coreUintW j = 0u; j < iStep; ++j) nFunction(j);
+
+    // wait for all other chunks (and help executing)
+    this->Wait(&oCounter);
+}
+
+
+#endif /* _CORE_GUARD_JOB_H_ */
\ No newline at end of file
@@ -8,32 +8,44 @@
 ///////////////////////////////////////////////////////////
 #include "Core.h"
 
+thread_local coreMemoryManager::coreThreadCache coreMemoryManager::s_Cache = {};
+
 
 // ****************************************************************
 /* constructor */
 coreMemoryPool::coreMemoryPool()noexcept
 : m_apPageList  {}
 , m_apFreeStack {}
+, m_pFreeList   (NULL)
+, m_iFreeCount  (0u)
+, m_bUnsorted   (false)
 , m_iBlockSize  (0u)
 , m_iPageSize   (0u)
+, m_eMode       (CORE_MEMORY_POOL_STACK)
 , m_pHeap       (NULL)
 {
 }
 
-coreMemoryPool::coreMemoryPool(const coreUintW iBlockSize, const coreUintW iPageSize)noexcept
+coreMemoryPool::coreMemoryPool(const coreUintW iBlockSize, const coreUintW iPageSize, const coreMemoryPoolMode eMode)noexcept
 : coreMemoryPool ()
 {
-    this->Configure(iBlockSize, iPageSize);
+    this->Configure(iBlockSize, iPageSize, eMode);
 }
 
 coreMemoryPool::coreMemoryPool(coreMemoryPool&& m)noexcept
 : m_apPageList  (std::move(m.m_apPageList))
 , m_apFreeStack (std::move(m.m_apFreeStack))
+, m_pFreeList   (m.m_pFreeList)
+, m_iFreeCount  (m.m_iFreeCount)
+, m_bUnsorted   (m.m_bUnsorted)
 , m_iBlockSize  (m.m_iBlockSize)
 , m_iPageSize   (m.m_iPageSize)
+, m_eMode       (m.m_eMode)
 , m_pHeap       (m.m_pHeap)
 {
-    m.m_pHeap = NULL;
+    m.m_pFreeList  = NULL;
+    m.m_iFreeCount = 0u;
+    m.m_pHeap      = NULL;
 }
 
 
@@ -56,8 +68,12 @@ coreMemoryPool& coreMemoryPool::operator = (coreMemoryPool&& m)noexcept
     // swap properties
     std::swap(m_apPageList,  m.m_apPageList);
     std::swap(m_apFreeStack, m.m_apFreeStack);
+    std::swap(m_pFreeList,   m.m_pFreeList);
+    std::swap(m_iFreeCount,  m.m_iFreeCount);
+    std::swap(m_bUnsorted,   m.m_bUnsorted);
     std::swap(m_iBlockSize,  m.m_iBlockSize);
     std::swap(m_iPageSize,   m.m_iPageSize);
+    std::swap(m_eMode,       m.m_eMode);
     std::swap(m_pHeap,       m.m_pHeap);
 
     return *this;
@@ -66,17 +82,18 @@ coreMemoryPool& coreMemoryPool::operator = (coreMemoryPool&& m)noexcept
 
 // ****************************************************************
 /* set required memory-pool properties */
-void coreMemoryPool::Configure(const coreUintW iBlockSize, const coreUintW iPageSize)
+void coreMemoryPool::Configure(const coreUintW iBlockSize, const coreUintW iPageSize, const coreMemoryPoolMode eMode)
 {
     ASSERT(iBlockSize && iPageSize)
     ASSERT(m_apPageList.empty())
 
-    // save memory-block and memory-page size
-    m_iBlockSize = iBlockSize;
+    // save memory-block and memory-page size (free-list requires space and alignment for the next-pointer)
+    m_iBlockSize = (eMode == CORE_MEMORY_POOL_LIST) ? coreMath::CeilAlign(MAX(iBlockSize, sizeof(void*)), alignof(void*)) : iBlockSize;
     m_iPageSize  = iPageSize;
+    m_eMode      = eMode;
 
     // reserve memory for the free-stack
-    m_apFreeStack.reserve(iPageSize);
+    if(m_eMode == CORE_MEMORY_POOL_STACK) m_apFreeStack.reserve(iPageSize);
 
     // create private heap object
     if(!m_pHeap) m_pHeap = coreData::HeapCreate(false);
@@ -87,7 +104,7 @@ void coreMemoryPool::Configure(const coreUintW iBlockSize, const coreUintW iPage
 /* reset memory-pool to its initial state */
 void coreMemoryPool::Reset()
 {
-    ASSERT(m_apFreeStack.size() == (m_apPageList.size() * m_iPageSize))
+    ASSERT((m_apFreeStack.size() + m_iFreeCount) == (m_apPageList.size() * m_iPageSize))
 
     // delete all memory-pages
     FOR_EACH(it, m_apPageList)
@@ -96,6 +113,42 @@ void coreMemoryPool::Reset()
     // clear memory
     m_apPageList .clear();
     m_apFreeStack.clear();
+
+    // reset free-list
+    m_pFreeList  = NULL;
+    m_iFreeCount = 0u;
+    m_bUnsorted  = false;
+}
+
+
+// ****************************************************************
+/* sort free-list by address (to restore locality after heavy fragmentation) */
+void coreMemoryPool::Sort()
+{
+    // only sort when order was actually lost
+    if(!m_bUnsorted) return;
+    ASSERT(m_eMode == CORE_MEMORY_POOL_LIST)
+
+    // collect all free memory-blocks
+    coreList<void*> apBlock;
+    apBlock.reserve(m_iFreeCount);
+    for(void* pBlock = m_pFreeList; pBlock; pBlock = coreMemoryPool::__GetNext(pBlock))
+    {
+        apBlock.push_back(pBlock);
+    }
+    ASSERT(apBlock.size() == m_iFreeCount)
+
+    // sort and re-link them (lowest address first)
+    std::sort(apBlock.begin(), apBlock.end());
+
+    m_pFreeList = NULL;
+    FOR_EACH_REV(it, apBlock)
+    {
+        coreMemoryPool::__SetNext(*it, m_pFreeList);
+        m_pFreeList = (*it);
+    }
+
+    m_bUnsorted = false;
 }
 
 
@@ -103,6 +156,20 @@ void coreMemoryPool::Reset()
 /* create memory-block */
 RETURN_RESTRICT void* coreMemoryPool::Allocate()
 {
+    if(m_eMode == CORE_MEMORY_POOL_LIST)
+    {
+        // check for free memory-block
+        if(!m_pFreeList) this->__AddPage();
+        ASSERT(m_pFreeList && m_iFreeCount)
+
+        // get pointer from the free-list
+        void* pMemory = m_pFreeList;
+        m_pFreeList = coreMemoryPool::__GetNext(pMemory);
+        m_iFreeCount -= 1u;
+
+        return pMemory;
+    }
+
     // check for free memory-block
     if(m_apFreeStack.empty()) this->__AddPage();
     ASSERT(!m_apFreeStack.empty())
@@ -121,6 +188,21 @@ void coreMemoryPool::Free(void** OUTPUT ppPointer)
 {
     ASSERT(this->Contains(*ppPointer))
 
+    if(m_eMode == CORE_MEMORY_POOL_LIST)
+    {
+        // track loss of address ordering (for lazy sorting)
+        if(m_pFreeList && (P_TO_UI(*ppPointer) > P_TO_UI(m_pFreeList))) m_bUnsorted = true;
+
+        // return pointer to the free-list
+        coreMemoryPool::__SetNext(*ppPointer, m_pFreeList);
+        m_pFreeList   = (*ppPointer);
+        m_iFreeCount += 1u;
+
+        // remove reference
+        (*ppPointer) = NULL;
+        return;
+    }
+
     // find target location with binary search
     ASSERT(std::is_sorted(m_apFreeStack.begin(), m_apFreeStack.end(), std::greater()))
     const auto it = std::lower_bound(m_apFreeStack.begin(), m_apFreeStack.end(), *ppPointer, std::greater());
@@ -133,6 +215,72 @@ void coreMemoryPool::Free(void** OUTPUT ppPointer)
 }
 
 
+// ****************************************************************
+/* create group of contiguous memory-blocks */
+RETURN_RESTRICT void* coreMemoryPool::AllocateGroup(const coreUintW iNum)
+{
+    ASSERT(iNum && (iNum <= m_iPageSize))
+
+    // single memory-blocks are always contiguous
+    if(iNum == 1u) return this->Allocate();
+
+    // search for a run of contiguous memory-blocks
+    void* pGroup = (m_eMode == CORE_MEMORY_POOL_LIST) ? this->__TakeRunList(iNum) : this->__TakeRunStack(iNum);
+    if(!pGroup)
+    {
+        // add new memory-page (which always contains a valid run)
+        this->__AddPage();
+
+        pGroup = (m_eMode == CORE_MEMORY_POOL_LIST) ? this->__TakeRunList(iNum) : this->__TakeRunStack(iNum);
+        ASSERT(pGroup)
+    }
+
+    return pGroup;
+}
+
+
+// ****************************************************************
+/* remove group of contiguous memory-blocks */
+void coreMemoryPool::FreeGroup(void** OUTPUT ppPointer, const coreUintW iNum)
+{
+    ASSERT(iNum && (iNum <= m_iPageSize) && this->Contains(*ppPointer) && this->Contains(this->GetGroupBlock(*ppPointer, iNum - 1u)))
+
+    coreByte* pGroup = s_cast<coreByte*>(*ppPointer);
+
+    if(m_eMode == CORE_MEMORY_POOL_LIST)
+    {
+        // track loss of address ordering (for lazy sorting)
+        if(m_pFreeList && (P_TO_UI(pGroup + (iNum - 1u) * m_iBlockSize) > P_TO_UI(m_pFreeList))) m_bUnsorted = true;
+
+        // return all pointers to the free-list (lowest address first)
+        for(coreUintW i = iNum; i--; )
+        {
+            coreByte* pBlock = pGroup + (i * m_iBlockSize);
+
+            coreMemoryPool::__SetNext(pBlock, m_pFreeList);
+            m_pFreeList = pBlock;
+        }
+        m_iFreeCount += iNum;
+    }
+    else
+    {
+        // find target location with binary search
+        ASSERT(std::is_sorted(m_apFreeStack.begin(), m_apFreeStack.end(), std::greater()))
+        const auto it = std::lower_bound(m_apFreeStack.begin(), m_apFreeStack.end(), pGroup, std::greater());
+
+        // return all pointers to the free-stack at once (highest address first)
+        const auto et = m_apFreeStack.insert(it, iNum, NULL);
+        for(coreUintW i = 0u; i < iNum; ++i)
+        {
+            et[i] = pGroup + ((iNum - 1u - i) * m_iBlockSize);
+        }
+    }
+
+    // remove reference
+    (*ppPointer) = NULL;
+}
+
+
 // ****************************************************************
 /* check if pointer belongs to the memory-pool */
 coreBool coreMemoryPool::Contains(const void* pPointer)const
@@ -152,19 +300,143 @@ void coreMemoryPool::__AddPage()
     coreByte* pNewPage = s_cast<coreByte*>(coreData::HeapMalloc(m_pHeap, m_iBlockSize * m_iPageSize));
     m_apPageList.push_back(pNewPage);
 
-    // add all containing memory-blocks to the free-stack
-    for(coreUintW i = m_iPageSize; i--; )
-        m_apFreeStack.push_back(pNewPage + (m_iBlockSize * i));
+    if(m_eMode == CORE_MEMORY_POOL_LIST)
+    {
+        // address ordering is lost when prepending to remaining memory-blocks
+        if(m_pFreeList) m_bUnsorted = true;
+
+        // link all containing memory-blocks into the free-list
+        for(coreUintW i = m_iPageSize; i--; )
+        {
+            coreByte* pBlock = pNewPage + (m_iBlockSize * i);
+
+            coreMemoryPool::__SetNext(pBlock, m_pFreeList);
+            m_pFreeList = pBlock;
+        }
+        m_iFreeCount += m_iPageSize;
+    }
+    else
+    {
+        const coreUintW iOldSize = m_apFreeStack.size();
+
+        // add all containing memory-blocks to the free-stack
+        for(coreUintW i = m_iPageSize; i--; )
+            m_apFreeStack.push_back(pNewPage + (m_iBlockSize * i));
+
+        // keep free-stack sorted when adding to remaining memory-blocks
+        if(iOldSize) std::inplace_merge(m_apFreeStack.begin(), m_apFreeStack.begin() + iOldSize, m_apFreeStack.end(), std::greater());
+    }
+}
+
+
+// ****************************************************************
+/* take run of contiguous memory-blocks from the free-stack */
+void* coreMemoryPool::__TakeRunStack(const coreUintW iNum)
+{
+    ASSERT(m_eMode == CORE_MEMORY_POOL_STACK)
+
+    // search from the lowest address (at the back of the free-stack)
+    coreUintW iRun = 0u;
+    for(coreUintW i = m_apFreeStack.size(); i--; )
+    {
+        // extend or restart current run
+        iRun = (iRun && (P_TO_UI(m_apFreeStack[i]) == P_TO_UI(m_apFreeStack[i + 1u]) + m_iBlockSize)) ? (iRun + 1u) : 1u;
+
+        if(iRun == iNum)
+        {
+            // remove whole run from the free-stack
+            void* pGroup = m_apFreeStack[i + iNum - 1u];
+            m_apFreeStack.erase(m_apFreeStack.begin() + i, m_apFreeStack.begin() + (i + iNum));
+
+            return pGroup;
+        }
+    }
+
+    return NULL;
+}
+
+
+// ****************************************************************
+/* take run of contiguous memory-blocks from the free-list */
+void* coreMemoryPool::__TakeRunList(const coreUintW iNum)
+{
+    ASSERT(m_eMode == CORE_MEMORY_POOL_LIST)
+
+    // runs can only be detected in sorted order
+    this->Sort();
+
+    void*     pPrev   = NULL;   // previous memory-block
+    void*     pBefore = NULL;   // memory-block before the current run
+    void*     pStart  = NULL;   // first memory-block of the current run
+    coreUintW iRun    = 0u;
+
+    for(void* pBlock = m_pFreeList; pBlock; pBlock = coreMemoryPool::__GetNext(pBlock))
+    {
+        // extend or restart current run
+        if(iRun && (P_TO_UI(pBlock) == P_TO_UI(pPrev) + m_iBlockSize))
+        {
+            iRun += 1u;
+        }
+        else
+        {
+            pBefore = pPrev;
+            pStart  = pBlock;
+            iRun    = 1u;
+        }
+
+        if(iRun == iNum)
+        {
+            // unlink whole run from the free-list
+            void* pAfter = coreMemoryPool::__GetNext(pBlock);
+            if(pBefore) coreMemoryPool::__SetNext(pBefore, pAfter);
+                   else m_pFreeList = pAfter;
+
+            m_iFreeCount -= iNum;
+            return pStart;
+        }
+
+        pPrev = pBlock;
+    }
+
+    return NULL;
+}
+
+
+// ****************************************************************
+/* constructor */
+coreMemoryManager::coreThreadCache::coreThreadCache()noexcept
+: aMagazine {}
+, pOwner    (NULL)
+, iHitCount (0u)
+{
+}
+
+
+// ****************************************************************
+/* destructor */
+coreMemoryManager::coreThreadCache::~coreThreadCache()
+{
+    // return all cached memory-blocks on thread exit
+    if(pOwner) pOwner->__ReleaseCache(this);
 }
 
 
 // ****************************************************************
 /* constructor */
 coreMemoryManager::coreMemoryManager()noexcept
-: m_apPointer   {}
-, m_aMemoryPool {}
-, m_PoolLock    ()
+: m_apPointer        {}
+, m_aMemoryPool      {}
+, m_aiSizeMask       {}
+, m_apCache          {}
+, m_iCacheHits       (0u)
+, m_iCacheMisses     (0u)
+, m_PoolLock         ()
+, m_FrameArena       ()
+, m_FrameArenaDouble ()
 {
+    // record lock statistics (only in lock statistics mode)
+    m_PoolLock.SetName("memory_pool");
+
     Core::Log->Info(CORE_LOG_BOLD("Memory Manager created"));
 }
 
@@ -173,9 +445,16 @@ coreMemoryManager::coreMemoryManager()noexcept
 /* destructor */
 coreMemoryManager::~coreMemoryManager()
 {
+    // return memory-blocks from all remaining thread-local caches (# other threads should already be finished)
+    while(!m_apCache.empty()) this->__ReleaseCache(m_apCache.back());
+
+    // write final memory-pool usage
+    this->LogUsage();
+    Core::Log->Info("Frame arena high-water marks: %zu bytes (single), %zu bytes (double)", m_FrameArena.GetHighWater(), m_FrameArenaDouble.GetHighWater());
+
     // clear memory
-    m_apPointer  .clear();
-    m_aMemoryPool.clear();
+    m_apPointer.clear();
+    for(coreUintW i = 0u; i < CORE_MEMORY_CLASSES; ++i) m_aMemoryPool[i].Reset();
 
     Core::Log->Info(CORE_LOG_BOLD("Memory Manager destroyed"));
 }
@@ -185,22 +464,221 @@ coreMemoryManager::~coreMemoryManager()
 /* create memory-block from internal memory-pool */
 RETURN_RESTRICT void* coreMemoryManager::Allocate(const coreUintW iSize)
 {
+    ASSERT(iSize)
+
+    // allocate big memory-blocks directly on the heap
+    if(iSize > CORE_MEMORY_BLOCK_MAX) return ALIGNED_NEW(coreByte, iSize, ALIGNMENT_NEW);
+
+    // remember requested block-size (only written once)
+    std::atomic<coreUint64>& iMask = m_aiSizeMask[iSize / 64u];
+    if(!(iMask.load(std::memory_order::relaxed) & BIT(iSize % 64u))) iMask.fetch_or(BIT(iSize % 64u), std::memory_order::relaxed);
+
+    // retrieve magazine from thread-local cache
+    const coreUintW iClass    = coreMemoryManager::__SizeToClass(iSize);
+    coreMagazine&   oMagazine = this->__RetrieveMagazine(iClass);
+
+    if(oMagazine.iCount)
+    {
+        // handle allocation without memory-pool access
+        s_Cache.iHitCount += 1u;
+    }
+    else
+    {
+        coreSpinLocker oLocker(&m_PoolLock);
+
+        // refill magazine from internal memory-pool
+        this->__Refill(&oMagazine, iClass);
+
+        // synchronize statistics
+        m_iCacheHits     += s_Cache.iHitCount;
+        m_iCacheMisses   += 1u;
+        s_Cache.iHitCount = 0u;
+    }
+
+    // take memory-block from the magazine
+    return oMagazine.apBlock[--oMagazine.iCount];
+}
+
+
+// ****************************************************************
+/* remove memory-block to internal memory-pool */
+void coreMemoryManager::Free(const coreUintW iSize, void** OUTPUT ppPointer)
+{
+    ASSERT(iSize)
+
+    // release big memory-blocks directly to the heap
+    if(iSize > CORE_MEMORY_BLOCK_MAX)
+    {
+        ALIGNED_DELETE(*ppPointer)
+        return;
+    }
+
+    // retrieve magazine from thread-local cache
+    const coreUintW iClass    = coreMemoryManager::__SizeToClass(iSize);
+    coreMagazine&   oMagazine = this->__RetrieveMagazine(iClass);
+
+    if(oMagazine.iCount < CORE_MEMORY_MAGAZINE_SIZE)
+    {
+        // handle free without memory-pool access
+        s_Cache.iHitCount += 1u;
+    }
+    else
+    {
+        coreSpinLocker oLocker(&m_PoolLock);
+
+        // flush part of the magazine to internal memory-pool
+        this->__Flush(&oMagazine, iClass, CORE_MEMORY_MAGAZINE_BATCH);
+
+        // synchronize statistics
+        m_iCacheHits     += s_Cache.iHitCount;
+        m_iCacheMisses   += 1u;
+        s_Cache.iHitCount = 0u;
+    }
+
+    // put memory-block into the magazine
+    oMagazine.apBlock[oMagazine.iCount++] = (*ppPointer);
+
+    // remove reference
+    (*ppPointer) = NULL;
+}
+
+
+// ****************************************************************
+/* get thread-local cache statistics */
+void coreMemoryManager::GetCacheStats(coreUint64* OUTPUT piHits, coreUint64* OUTPUT piMisses)
+{
+    ASSERT(piHits && piMisses)
+
     coreSpinLocker oLocker(&m_PoolLock);
 
-    // check and create memory-pool
-    if(!m_aMemoryPool.count(iSize)) m_aMemoryPool.emplace(iSize, iSize, 128u);
+    // return synchronized statistics (including the calling thread)
+    (*piHits)   = m_iCacheHits + s_Cache.iHitCount;
+    (*piMisses) = m_iCacheMisses;
+}
+
 
-    // forward request to internal memory-pool
-    return m_aMemoryPool.at(iSize).Allocate();
+// ****************************************************************
+/* write memory-pool usage to the log file */
+void coreMemoryManager::LogUsage()
+{
+    coreSpinLocker oLocker(&m_PoolLock);
+
+    coreUintW iClasses  = 0u;
+    coreUintW iSizes    = 0u;
+    coreUintW iReserved = 0u;
+    coreUintW iUsed     = 0u;
+
+    // count all block-sizes ever requested (each would have required its own memory-pool without size-classes)
+    for(coreUintW i = 0u; i < ARRAY_SIZE(m_aiSizeMask); ++i)
+        iSizes += std::popcount(m_aiSizeMask[i].load(std::memory_order::relaxed));
+
+    Core::Log->ListStartInfo("Memory Pool Usage");
+    {
+        for(coreUintW i = 0u; i < CORE_MEMORY_CLASSES; ++i)
+        {
+            const coreMemoryPool& oPool = m_aMemoryPool[i];
+            if(!oPool.GetNumPages()) continue;
+
+            const coreUintW iTotal = oPool.GetNumPages() * oPool.GetPageSize();
+            const coreUintW iAlive = iTotal - oPool.GetNumFree();
+
+            Core::Log->ListAdd("%zu bytes: %zu pages, %zu/%zu blocks used", oPool.GetBlockSize(), oPool.GetNumPages(), iAlive, iTotal);
+
+            iClasses  += 1u;
+            iReserved += iTotal * oPool.GetBlockSize();
+            iUsed     += iAlive * oPool.GetBlockSize();
+        }
+    }
+    Core::Log->ListEnd();
+
+    const coreUint64 iTotal = m_iCacheHits + m_iCacheMisses;
+    Core::Log->Info("Memory Manager: %zu block-sizes in %zu size-classes, %zu KiB reserved, %zu KiB used (in memory-pools), cache hit rate %.2f%% (%llu hits, %llu misses)",
+                    iSizes, iClasses, iReserved / 1024u, iUsed / 1024u, iTotal ? (coreDouble(m_iCacheHits) / coreDouble(iTotal) * 100.0) : 0.0, m_iCacheHits, m_iCacheMisses);
 }
 
 
 // ****************************************************************
-/* remove memory-block to internal memory-pool */
-void coreMemoryManager::Free(const coreUintW iSize, void** OUTPUT ppPointer)
+/* reset frame arenas */
+void coreMemoryManager::__UpdateFrame()
+{
+    // release all temporary memory of the oldest frame
+    m_FrameArena      .Reset();
+    m_FrameArenaDouble.Reset();
+}
+
+
+// ****************************************************************
+/* refill empty magazine from internal memory-pool */
+void coreMemoryManager::__Refill(coreMagazine* OUTPUT pMagazine, const coreUintW iClass)
+{
+    ASSERT(m_PoolLock.IsLocked() && !pMagazine->iCount && (iClass < CORE_MEMORY_CLASSES))
+
+    // check and configure memory-pool
+    coreMemoryPool& oPool = m_aMemoryPool[iClass];
+    if(!oPool.GetBlockSize()) oPool.Configure(coreMemoryManager::__ClassToSize(iClass), CORE_MEMORY_PAGE_BLOCKS, CORE_MEMORY_POOL_LIST);
+
+    // take multiple memory-blocks at once (lowest address on top)
+    for(coreUintW i = CORE_MEMORY_MAGAZINE_BATCH; i--; )
+        pMagazine->apBlock[i] = oPool.Allocate();
+
+    pMagazine->iCount = CORE_MEMORY_MAGAZINE_BATCH;
+}
+
+
+// ****************************************************************
+/* flush oldest memory-blocks from magazine to internal memory-pool */
+void coreMemoryManager::__Flush(coreMagazine* OUTPUT pMagazine, const coreUintW iClass, const coreUintW iNum)
+{
+    ASSERT(m_PoolLock.IsLocked() && (pMagazine->iCount >= iNum) && (iClass < CORE_MEMORY_CLASSES))
+
+    // return multiple memory-blocks at once
+    coreMemoryPool& oPool = m_aMemoryPool[iClass];
+    for(coreUintW i = 0u; i < iNum; ++i)
+        oPool.Free(&pMagazine->apBlock[i]);
+
+    // keep recently freed memory-blocks in the magazine
+    pMagazine->iCount -= iNum;
+    std::memmove(pMagazine->apBlock, pMagazine->apBlock + iNum, pMagazine->iCount * sizeof(void*));
+}
+
+
+// ****************************************************************
+/* retrieve magazine from thread-local cache */
+coreMemoryManager::coreMagazine& coreMemoryManager::__RetrieveMagazine(const coreUintW iClass)
+{
+    ASSERT(iClass < CORE_MEMORY_CLASSES)
+
+    if(!s_Cache.pOwner)
+    {
+        coreSpinLocker oLocker(&m_PoolLock);
+
+        // register thread-local cache
+        s_Cache.pOwner = this;
+        m_apCache.push_back(&s_Cache);
+    }
+
+    return s_Cache.aMagazine[iClass];
+}
+
+
+// ****************************************************************
+/* return all memory-blocks from thread-local cache */
+void coreMemoryManager::__ReleaseCache(coreThreadCache* OUTPUT pCache)
 {
     coreSpinLocker oLocker(&m_PoolLock);
 
-    // forward request to internal memory-pool
-    m_aMemoryPool.at(iSize).Free(ppPointer);
+    // flush all magazines
+    for(coreUintW i = 0u; i < CORE_MEMORY_CLASSES; ++i)
+    {
+        coreMagazine& oMagazine = pCache->aMagazine[i];
+        if(oMagazine.iCount) this->__Flush(&oMagazine, i, oMagazine.iCount);
+    }
+
+    // synchronize statistics
+    m_iCacheHits      += pCache->iHitCount;
+    pCache->iHitCount  = 0u;
+
+    // unregister thread-local cache
+    m_apCache.erase(std::find(m_apCache.begin(), m_apCache.end(), pCache));
+    pCache->pOwner = NULL;
 }
\ No newline at end of file
@@ -12,13 +12,10 @@
 
 // TODO 5: memory-pool: main-page + smaller extension-pages
 // TODO 5: memory-pool: usable with coreList & co
-// TODO 5: memory-pool: support polymorphism
-// TODO 5: memory-pool: 1 block for multiple objects
 // TODO 5: add interface for reusing big memory-blocks (free when?)
 // TODO 5: __declspec(allocator)
-// TODO 3: pointer to next free block inside unused block (linked list) instead of free-stack (consider sorting)
 // TODO 5: <old comment style>
-// TODO 3: implement quick free and quick reset to memory pool (but not to manager), without sorting (and without insertion?), for regular destruction
+// TODO 3: implement quick reset to memory pool (but not to manager), for regular destruction
 // TODO 3: #define STATIC_EXTERN(t,p) extern t* const p; needs to be before Core class
 
 
@@ -27,14 +24,26 @@
 #define CORE_MEMORY_SHARED  (STRING(__FILE__) ":" STRING(__LINE__))
 #define CORE_MEMORY_UNIQUE  (PRINT(CORE_MEMORY_SHARED ":%p", this))
 
+#define CORE_MEMORY_MAGAZINE_SIZE  (32u)                                // number of memory-blocks cached per thread and block-size
+#define CORE_MEMORY_MAGAZINE_BATCH (CORE_MEMORY_MAGAZINE_SIZE / 2u)     // number of memory-blocks exchanged with the memory-pool at once
+#define CORE_MEMORY_CLASSES        (44u)                                // number of size-classes (16-byte steps up to 64 bytes, then 4 steps per power of two up to 64 KiB)
+#define CORE_MEMORY_PAGE_BLOCKS    (128u)                               // number of memory-blocks per memory-page of the internal memory-pools
+#define CORE_MEMORY_BLOCK_MAX      (0xFFFFu)                            // max block-size handled by the internal memory-pools (bigger memory-blocks are allocated on the heap)
+#define CORE_MEMORY_ARENA_SIZE     (1u * 1024u * 1024u)                 // default size of each frame arena buffer (in bytes)
+#define CORE_MEMORY_ARENA_POISON   (0xCDu)                              // byte pattern written into released frame arena memory (only in debug mode)
+
 #define __ALLOC_CHECK(t,c)  ([](const coreUintW iSize) {STATIC_ASSERT(std::is_trivial<typename std::decay<t>::type>::value) ASSERT(iSize)}(c))
+#define __POOL_CHECK(m,t)   ([](const coreUintW iBlockSize) {STATIC_ASSERT(alignof(t) <= ALIGNMENT_NEW) ASSERT(sizeof(t) <= iBlockSize)}((m).GetBlockSize()))
 
 #define MANAGED_NEW(t,...)  (ASSUME_ALIGNED(new(Core::Manager::Memory->Allocate(sizeof(t))) t(__VA_ARGS__), alignof(t)))
 #define MANAGED_DELETE(p)   {if(p) {CALL_DESTRUCTOR(p) Core::Manager::Memory->Free(sizeof(*(p)), r_cast<void**>(&(p)));}}
 
-#define POOLED_NEW(m,t,...) (ASSUME_ALIGNED(new((m).Allocate()) t(__VA_ARGS__), alignof(t)))
+#define POOLED_NEW(m,t,...) (__POOL_CHECK(m, t), ASSUME_ALIGNED(new((m).Allocate()) t(__VA_ARGS__), alignof(t)))
 #define POOLED_DELETE(m,p)  {if(p) {CALL_DESTRUCTOR(p) (m).Free(r_cast<void**>(&(p)));}}
 
+#define POOLED_NEW_GROUP(m,t,n,...) (__POOL_CHECK(m, t), (m).NewGroup<t>((n), ##__VA_ARGS__))
+#define POOLED_DELETE_GROUP(m,p)    {(m).DeleteGroup(&(p));}
+
 #define ALIGNED_NEW(t,c,a)  (__ALLOC_CHECK(t, c), ASSUME_ALIGNED(s_cast<t*>(_aligned_malloc((c) * sizeof(t), (a))), (a)))
 #define ALIGNED_DELETE(p)   {_aligned_free(p); (p) = NULL;}
 
@@ -59,6 +68,41 @@
     #define aligned_alloc aligned_alloc_macos
 #endif
 
+enum coreMemoryPoolMode : coreUint8
+{
+    CORE_MEMORY_POOL_STACK = 0u,   // sorted free-stack (always returns the lowest free address, logarithmic free)
+    CORE_MEMORY_POOL_LIST  = 1u    // intrusive free-list inside unused memory-blocks (constant free, sorted on demand)
+};
+
+
+// ****************************************************************
+/* memory-group class (objects within contiguous memory-blocks, separated by the block-size instead of the object size) */
+template <typename T> class coreMemoryGroup final
+{
+private:
+    coreByte* m_pGroup;    // first memory-block of the group
+    coreUintW m_iStride;   // distance between two objects (block-size of the memory-pool)
+    coreUintW m_iNum;      // number of objects
+
+
+public:
+    constexpr coreMemoryGroup()noexcept : m_pGroup (NULL), m_iStride (0u), m_iNum (0u) {}
+    coreMemoryGroup(void* pGroup, const coreUintW iStride, const coreUintW iNum)noexcept : m_pGroup (s_cast<coreByte*>(pGroup)), m_iStride (iStride), m_iNum (iNum) {}
+
+    ENABLE_COPY(coreMemoryGroup)
+
+    /* access objects (no pointer arithmetic on the objects, they are not sizeof(T) apart) */
+    inline T& operator [] (const coreUintW iIndex)const {ASSERT(iIndex < m_iNum) return *std::launder(r_cast<T*>(m_pGroup + iIndex * m_iStride));}
+
+    /* check for valid group */
+    constexpr explicit operator coreBool ()const {return (m_pGroup != NULL);}
+
+    /* get object properties */
+    constexpr void*            GetData  ()const {return m_pGroup;}
+    constexpr const coreUintW& GetStride()const {return m_iStride;}
+    constexpr const coreUintW& GetSize  ()const {return m_iNum;}
+};
+
 
 // ****************************************************************
 /* memory-pool class */
@@ -66,17 +110,22 @@ class coreMemoryPool final
 {
 private:
     coreList<coreByte*> m_apPageList;    // list with memory-pages containing many memory-blocks
-    coreList<void*>     m_apFreeStack;   // stack with pointers to free memory-blocks
+    coreList<void*>     m_apFreeStack;   // stack with pointers to free memory-blocks (in stack-mode)
+
+    void*     m_pFreeList;               // first free memory-block, each containing a pointer to the next one (in list-mode)
+    coreUintW m_iFreeCount;              // number of memory-blocks in the free-list
+    coreBool  m_bUnsorted;               // free-list is not ordered by address anymore
 
     coreUintW m_iBlockSize;              // memory-block size (in bytes)
     coreUintW m_iPageSize;               // memory-page size (in number of containing memory-blocks)
 
-    void* m_pHeap;                       // private heap object
+    coreMemoryPoolMode m_eMode;          // management mode for free memory-blocks
+    void*              m_pHeap;          // private heap object
 
 
 public:
     coreMemoryPool()noexcept;
-    coreMemoryPool(const coreUintW iBlockSize, const coreUintW iPageSize)noexcept;
+    coreMemoryPool(const coreUintW iBlockSize, const coreUintW iPageSize, const coreMemoryPoolMode eMode = CORE_MEMORY_POOL_STACK)noexcept;
     coreMemoryPool(coreMemoryPool&& m)noexcept;
     ~coreMemoryPool();
 
@@ -84,20 +133,119 @@ public:
     coreMemoryPool& operator = (coreMemoryPool&& m)noexcept;
 
     /* control state of the memory-pool */
-    void Configure(const coreUintW iBlockSize, const coreUintW iPageSize);
+    void Configure(const coreUintW iBlockSize, const coreUintW iPageSize, const coreMemoryPoolMode eMode = CORE_MEMORY_POOL_STACK);
+    template <typename... T> void ConfigureTypes(const coreUintW iPageSize, const coreMemoryPoolMode eMode = CORE_MEMORY_POOL_STACK);
     void Reset();
+    void Sort ();
 
     /* create and remove memory-blocks */
     RETURN_RESTRICT void* Allocate();
     void Free(void** OUTPUT ppPointer);
 
+    /* create and remove groups of contiguous memory-blocks (released in one call) */
+    RETURN_RESTRICT void* AllocateGroup(const coreUintW iNum);
+    void FreeGroup(void** OUTPUT ppPointer, const coreUintW iNum);
+    inline void* GetGroupBlock(void* pGroup, const coreUintW iIndex)const {ASSERT(iIndex < m_iPageSize) return s_cast<coreByte*>(pGroup) + (iIndex * m_iBlockSize);}
+
+    /* create and remove groups of objects (each within its own memory-block) */
+    template <typename T, typename... A> coreMemoryGroup<T> NewGroup(const coreUintW iNum, A&&... vArgs);
+    template <typename T> void DeleteGroup(coreMemoryGroup<T>* OUTPUT pGroup);
+
     /* check if pointer belongs to the memory-pool */
     coreBool Contains(const void* pPointer)const;
 
+    /* get object properties */
+    inline const coreUintW&          GetBlockSize()const {return m_iBlockSize;}
+    inline const coreUintW&          GetPageSize ()const {return m_iPageSize;}
+    inline       coreUintW           GetNumPages ()const {return m_apPageList.size();}
+    inline       coreUintW           GetNumFree  ()const {return m_apFreeStack.size() + m_iFreeCount;}
+    inline const coreMemoryPoolMode& GetMode     ()const {return m_eMode;}
+
 
 private:
     /* add new memory-page to memory-pool */
     void __AddPage();
+
+    /* take run of contiguous memory-blocks (or return NULL) */
+    void* __TakeRunStack(const coreUintW iNum);
+    void* __TakeRunList (const coreUintW iNum);
+
+    /* access pointer to the next free memory-block */
+    static FORCE_INLINE void* __GetNext(const void* pBlock)              {void* pNext; std::memcpy(&pNext, pBlock, sizeof(void*)); return pNext;}
+    static FORCE_INLINE void  __SetNext(void* OUTPUT pBlock, void* pNext) {std::memcpy(pBlock, &pNext, sizeof(void*));}
+};
+
+
+// ****************************************************************
+/* frame arena class */
+template <coreUintW iBuffers> class coreFrameArenaGen final
+{
+private:
+    /* buffer structure */
+    struct coreBuffer final
+    {
+        coreByte*       pData;        // pre-allocated memory
+        coreUintW       iCurrent;     // current bump offset
+        coreUintW       iOverflow;    // number of bytes allocated from the heap after the buffer was exhausted
+        coreList<void*> apOverflow;   // heap memory-blocks allocated after the buffer was exhausted
+    };
+
+
+private:
+    coreBuffer m_aBuffer[iBuffers];   // buffers (each containing the memory of one frame)
+    coreUintW  m_iSize;               // size of each buffer (in bytes)
+    coreUintW  m_iIndex;              // index of the current buffer
+
+    coreUintW m_iHighWater;           // highest number of bytes used within one frame
+
+    SDL_threadID m_iOwnerThread;      // thread-ID from the creator (the only thread allowed to use the arena)
+
+
+public:
+    explicit coreFrameArenaGen(const coreUintW iSize = CORE_MEMORY_ARENA_SIZE)noexcept;
+    ~coreFrameArenaGen();
+
+    DISABLE_COPY(coreFrameArenaGen)
+
+    /* create and remove memory */
+    RETURN_RESTRICT void* Allocate(const coreUintW iSize, const coreUintW iAlign = ALIGNMENT_NEW);
+    void                  Free    (void* pPointer, const coreUintW iSize);
+
+    /* start new frame (releases all memory allocated iBuffers frames ago) */
+    void Reset();
+
+    /* get object properties */
+    inline       coreUintW  GetUsed     ()const {return m_aBuffer[m_iIndex].iCurrent + m_aBuffer[m_iIndex].iOverflow;}
+    inline const coreUintW& GetSize     ()const {return m_iSize;}
+    inline const coreUintW& GetHighWater()const {return m_iHighWater;}
+};
+
+
+// ****************************************************************
+/* frame arena types */
+using coreFrameArena       = coreFrameArenaGen<1u>;   // memory is valid until the end of the current frame
+using coreFrameArenaDouble = coreFrameArenaGen<2u>;   // memory is valid until the end of the next frame
+
+
+// ****************************************************************
+/* frame arena allocator class (for STL-compatible containers, e.g. coreList<T, coreFrameAlloc<T>>) */
+template <typename T> class coreFrameAlloc
+{
+public:
+    using value_type = T;
+
+
+public:
+    coreFrameAlloc() = default;
+    template <typename S> constexpr coreFrameAlloc(const coreFrameAlloc<S>&)noexcept {}
+
+    /* create and remove memory */
+    RETURN_RESTRICT T* allocate  (const coreUintW iNum);
+    void               deallocate(T* pPointer, const coreUintW iNum);
+
+    /* compare allocators (all share the same frame arena) */
+    template <typename S> constexpr coreBool operator == (const coreFrameAlloc<S>&)const {return true;}
+    template <typename S> constexpr coreBool operator != (const coreFrameAlloc<S>&)const {return false;}
 };
 
 
@@ -105,12 +253,43 @@ private:
 /* memory manager */
 class coreMemoryManager final
 {
+private:
+    /* magazine structure */
+    struct coreMagazine final
+    {
+        void*     apBlock[CORE_MEMORY_MAGAZINE_SIZE];   // cached free memory-blocks
+        coreUintW iCount;                               // number of cached memory-blocks
+    };
+
+    /* thread-local cache structure */
+    struct coreThreadCache final
+    {
+        coreMagazine       aMagazine[CORE_MEMORY_CLASSES];   // magazines (each for a different size-class)
+        coreMemoryManager* pOwner;                           // registered memory manager (NULL = not registered)
+        coreUint64         iHitCount;                        // number of cache hits since last synchronization
+
+        coreThreadCache()noexcept;
+        ~coreThreadCache();
+    };
+
+
 private:
     coreMapStr<std::weak_ptr<void>>     m_apPointer;     // list with weak shared memory pointer
-    coreMap<coreUint16, coreMemoryPool> m_aMemoryPool;   // internal memory-pools (each for a different block-size)
+    coreMemoryPool m_aMemoryPool[CORE_MEMORY_CLASSES];   // internal memory-pools (each for a different size-class, directly indexed)
+
+    std::atomic<coreUint64> m_aiSizeMask[(CORE_MEMORY_BLOCK_MAX + 1u) / 64u];   // all block-sizes ever requested (one bit each, for usage report)
+
+    coreList<coreThreadCache*> m_apCache;                // all registered thread-local caches
+    coreUint64 m_iCacheHits;                             // total number of allocations and frees handled only by thread-local caches
+    coreUint64 m_iCacheMisses;                           // total number of refills and flushes with the memory-pools
 
     coreSpinLock m_PoolLock;                             // spinlock to prevent invalid memory-pool access
 
+    coreFrameArena       m_FrameArena;                   // frame arena for temporary memory (only main-thread)
+    coreFrameArenaDouble m_FrameArenaDouble;             // frame arena for temporary memory surviving into the next frame (only main-thread)
+
+    static thread_local coreThreadCache s_Cache;         // thread-local cache in front of the memory-pools
+
 
 private:
     coreMemoryManager()noexcept;
@@ -127,9 +306,243 @@ public:
     /* create and remove memory-blocks through internal memory-pools */
     RETURN_RESTRICT void* Allocate(const coreUintW iSize);
     void Free(const coreUintW iSize, void** OUTPUT ppPointer);
+
+    /* get thread-local cache statistics */
+    void GetCacheStats(coreUint64* OUTPUT piHits, coreUint64* OUTPUT piMisses);
+
+    /* write memory-pool usage to the log file */
+    void LogUsage();
+
+    /* access frame arenas */
+    inline coreFrameArena*       GetFrameArena      () {return &m_FrameArena;}
+    inline coreFrameArenaDouble* GetFrameArenaDouble() {return &m_FrameArenaDouble;}
+
+
+private:
+    /* reset frame arenas */
+    void __UpdateFrame();
+
+    /* exchange memory-blocks between thread-local cache and memory-pools */
+    void __Refill(coreMagazine* OUTPUT pMagazine, const coreUintW iClass);
+    void __Flush (coreMagazine* OUTPUT pMagazine, const coreUintW iClass, const coreUintW iNum);
+
+    /* handle thread-local caches */
+    coreMagazine& __RetrieveMagazine(const coreUintW iClass);
+    void          __ReleaseCache    (coreThreadCache* OUTPUT pCache);
+
+    /* convert between block-size and size-class */
+    static constexpr coreUintW __SizeToClass(const coreUintW iSize);
+    static constexpr coreUintW __ClassToSize(const coreUintW iClass);
 };
 
 
+// ****************************************************************
+/* set memory-pool properties to hold any of the given types (e.g. a class hierarchy) */
+template <typename... T> void coreMemoryPool::ConfigureTypes(const coreUintW iPageSize, const coreMemoryPoolMode eMode)
+{
+    STATIC_ASSERT(sizeof...(T) && (std::max({alignof(T)...}) <= ALIGNMENT_NEW))
+
+    // use biggest type size, aligned to the strictest type alignment
+    this->Configure(coreMath::CeilAlign(std::max({sizeof(T)...}), std::max({alignof(T)...})), iPageSize, eMode);
+}
+
+
+// ****************************************************************
+/* create group of objects */
+template <typename T, typename... A> coreMemoryGroup<T> coreMemoryPool::NewGroup(const coreUintW iNum, A&&... vArgs)
+{
+    ASSERT(sizeof(T) <= m_iBlockSize)
+
+    // allocate contiguous memory-blocks
+    void* pGroup = this->AllocateGroup(iNum);
+
+    // construct all objects (with the same arguments)
+    for(coreUintW i = 0u; i < iNum; ++i)
+    {
+        new(this->GetGroupBlock(pGroup, i)) T(vArgs...);
+    }
+
+    return coreMemoryGroup<T>(pGroup, m_iBlockSize, iNum);
+}
+
+
+// ****************************************************************
+/* remove group of objects */
+template <typename T> void coreMemoryPool::DeleteGroup(coreMemoryGroup<T>* OUTPUT pGroup)
+{
+    if(!(*pGroup)) return;
+    ASSERT(pGroup->GetStride() == m_iBlockSize)
+
+    // destruct all objects (virtual destructors handle derived types)
+    for(coreUintW i = 0u, ie = pGroup->GetSize(); i < ie; ++i)
+    {
+        T* pObject = &(*pGroup)[i];
+        CALL_DESTRUCTOR(pObject)
+    }
+
+    // release contiguous memory-blocks at once
+    void* pData = pGroup->GetData();
+    this->FreeGroup(&pData, pGroup->GetSize());
+
+    (*pGroup) = coreMemoryGroup<T>();
+}
+
+
+// ****************************************************************
+/* constructor */
+template <coreUintW iBuffers> coreFrameArenaGen<iBuffers>::coreFrameArenaGen(const coreUintW iSize)noexcept
+: m_aBuffer      {}
+, m_iSize        (coreMath::CeilAlign(iSize, ALIGNMENT_PAGE))
+, m_iIndex       (0u)
+, m_iHighWater   (0u)
+, m_iOwnerThread (SDL_ThreadID())
+{
+    // pre-allocate all buffers
+    for(coreUintW i = 0u; i < iBuffers; ++i)
+    {
+        m_aBuffer[i].pData = ALIGNED_NEW(coreByte, m_iSize, ALIGNMENT_PAGE);
+    }
+}
+
+
+// ****************************************************************
+/* destructor */
+template <coreUintW iBuffers> coreFrameArenaGen<iBuffers>::~coreFrameArenaGen()
+{
+    // release all heap memory
+    for(coreUintW i = 0u; i < iBuffers; ++i) this->Reset();
+
+    // delete all buffers
+    for(coreUintW i = 0u; i < iBuffers; ++i) ALIGNED_DELETE(m_aBuffer[i].pData)
+}
+
+
+// ****************************************************************
+/* create memory */
+template <coreUintW iBuffers> RETURN_RESTRICT void* coreFrameArenaGen<iBuffers>::Allocate(const coreUintW iSize, const coreUintW iAlign)
+{
+    ASSERT(iSize && coreMath::IsPot(iAlign))
+    ASSERT(SDL_ThreadID() == m_iOwnerThread)
+
+    coreBuffer& oBuffer = m_aBuffer[m_iIndex];
+
+    // bump current offset
+    const coreUintW iStart = coreMath::CeilAlign(oBuffer.iCurrent, iAlign);
+    if(iStart + iSize <= m_iSize)
+    {
+        oBuffer.iCurrent = iStart + iSize;
+        return oBuffer.pData + iStart;
+    }
+
+    // fall back to heap memory when buffer is exhausted
+    void* pMemory = ALIGNED_NEW(coreByte, iSize, MAX(iAlign, ALIGNMENT_NEW));
+    oBuffer.apOverflow.push_back(pMemory);
+    oBuffer.iOverflow += iSize;
+
+    return pMemory;
+}
+
+
+// ****************************************************************
+/* remove memory */
+template <coreUintW iBuffers> void coreFrameArenaGen<iBuffers>::Free(void* pPointer, const coreUintW iSize)
+{
+    ASSERT(SDL_ThreadID() == m_iOwnerThread)
+
+    coreBuffer& oBuffer = m_aBuffer[m_iIndex];
+
+    // only release most recent memory (everything else is released with the buffer)
+    coreByte* pEnd = s_cast<coreByte*>(pPointer) + iSize;
+    if(pEnd == oBuffer.pData + oBuffer.iCurrent) oBuffer.iCurrent = s_cast<coreByte*>(pPointer) - oBuffer.pData;
+
+#if defined(_CORE_DEBUG_)
+
+    // poison released memory
+    if((pPointer >= oBuffer.pData) && (pEnd <= oBuffer.pData + m_iSize)) std::memset(pPointer, CORE_MEMORY_ARENA_POISON, iSize);
+
+#endif
+}
+
+
+// ****************************************************************
+/* start new frame */
+template <coreUintW iBuffers> void coreFrameArenaGen<iBuffers>::Reset()
+{
+    ASSERT(SDL_ThreadID() == m_iOwnerThread)
+
+    // track highest memory usage
+    m_iHighWater = MAX(m_iHighWater, this->GetUsed());
+
+    // switch to the oldest buffer
+    m_iIndex = (m_iIndex + 1u) % iBuffers;
+    coreBuffer& oBuffer = m_aBuffer[m_iIndex];
+
+    // release heap memory
+    if(!oBuffer.apOverflow.empty())
+    {
+        Core::Log->Warning("Frame arena exhausted (%zu bytes size, %zu bytes overflow)", m_iSize, oBuffer.iOverflow);
+
+        FOR_EACH(it, oBuffer.apOverflow) ALIGNED_DELETE(*it)
+        oBuffer.apOverflow.clear();
+    }
+
+#if defined(_CORE_DEBUG_)
+
+    // poison released memory
+    std::memset(oBuffer.pData, CORE_MEMORY_ARENA_POISON, oBuffer.iCurrent);
+
+#endif
+
+    // reset current offset
+    oBuffer.iCurrent  = 0u;
+    oBuffer.iOverflow = 0u;
+}
+
+
+// ****************************************************************
+/* create memory */
+template <typename T> RETURN_RESTRICT T* coreFrameAlloc<T>::allocate(const coreUintW iNum)
+{
+    return s_cast<T*>(Core::Manager::Memory->GetFrameArena()->Allocate(iNum * sizeof(T), alignof(T)));
+}
+
+
+// ****************************************************************
+/* remove memory */
+template <typename T> void coreFrameAlloc<T>::deallocate(T* pPointer, const coreUintW iNum)
+{
+    Core::Manager::Memory->GetFrameArena()->Free(pPointer, iNum * sizeof(T));
+}
+
+
+// ****************************************************************
+/* convert block-size to size-class */
+constexpr coreUintW coreMemoryManager::__SizeToClass(const coreUintW iSize)
+{
+    ASSERT(iSize && (iSize <= CORE_MEMORY_BLOCK_MAX))
+
+    // use 16-byte steps for small sizes
+    const coreUintW iValue = iSize - 1u;
+    if(iValue < 64u) return iValue >> 4u;
+
+    // use four steps per power of two for bigger sizes
+    const coreUintW iWidth = std::bit_width(iValue);
+    return (iWidth - 7u) * 4u + (iValue >> (iWidth - 3u));
+}
+
+
+// ****************************************************************
+/* convert size-class to block-size */
+constexpr coreUintW coreMemoryManager::__ClassToSize(const coreUintW iClass)
+{
+    ASSERT(iClass < CORE_MEMORY_CLASSES)
+
+    // invert size-class calculation (always returns the biggest block-size of the size-class)
+    if(iClass < 4u) return (iClass + 1u) * 16u;
+    return ((iClass % 4u) + 5u) << ((iClass - 4u) / 4u + 4u);
+}
+
+
 // ****************************************************************
 /* share memory pointer through specific identifier */
 template <typename T, typename... A> std::shared_ptr<T> coreMemoryManager::Share(const coreHashString& sName, A&&... vArgs)
@@ -8,6 +8,11 @@
 ///////////////////////////////////////////////////////////
 #include "Core.h"
 
+#if defined(_CORE_LINUX_)
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
 
 // ****************************************************************
 /* constructor */
@@ -19,7 +24,21 @@ coreResourceHandle::coreResourceHandle(coreResource* pResource, coreFile* pFile,
 , m_eStatus    ((pFile || bAutomatic) ? CORE_BUSY : CORE_OK)
 , m_iRefCount  (0u)
 , m_UpdateLock ()
+, m_ePriority    (CORE_RESOURCE_PRIORITY_VISIBLE)
+, m_bQueued      (false)
+, m_iMemorySize  (0u)
+, m_dReleaseTime (0.0)
+, m_bReleased    (false)
+, m_iTrackState  (0u)
+, m_iTrackStart  (0u)
+, m_afLoadTime   {}
+, m_fLoadLatency (0.0f)
+, m_pPlaceholder (NULL)
+, m_bReady       (false)
+, m_bWaiting     (false)
 {
+    // record lock statistics (only in lock statistics mode)
+    m_UpdateLock.SetName("resource_update");
 }
 
 
@@ -71,18 +90,66 @@ void coreResourceRelation::__Reshape()
 // ****************************************************************
 /* constructor */
 coreResourceManager::coreResourceManager()noexcept
-: coreThread     ("resource_thread")
-, m_apHandle     {}
-, m_apArchive    {}
-, m_apDirectFile {}
-, m_apProxy      {}
-, m_apRelation   {}
-, m_ResourceLock ()
-, m_FileLock     ()
-, m_bActive      (false)
-{
-    // configure resource thread
-    this->SetFrequency(120.0f);
+: coreThread      ("resource_thread")
+, m_apHandle      {}
+, m_apArchive     {}
+, m_apDirectFile  {}
+, m_apFileIndex   {}
+, m_bDirectMode   (Core::Config->GetBool(CORE_CONFIG_BASE_DIRECTMODE))
+, m_apProxy       {}
+, m_apRelation    {}
+, m_aapQueue      {}
+, m_aiQueueHead   {}
+, m_iQueueNum     (0u)
+, m_QueueLock     ()
+, m_apRetry       {}
+, m_apBatch       {}
+, m_apDecode      {}
+, m_apDecodeFile  {}
+, m_iDecodeNum    (0u)
+, m_DecodeLock    ()
+, m_DecodeCounter ()
+, m_bDecodeActive (false)
+, m_apRelease     {}
+, m_ReleaseLock   ()
+, m_iMemoryUsage  (0u)
+, m_asRecord      {}
+, m_aiRecordHash  {}
+, m_bRecording    (false)
+, m_RecordLock    ()
+, m_apPrefetch    {}
+, m_iTrackQueued     (0u)
+, m_iTrackActive     (0u)
+, m_iTrackDone       (0u)
+, m_iTrackBytesTotal (0u)
+, m_iTrackBytesDone  (0u)
+, m_iTrackStart      (0u)
+, m_TrackLock        ()
+, m_apDefault        {}
+, m_apPlaceholder    {}
+, m_apWaiting        {}
+, m_iWaitingNum      (0u)
+, m_PlaceholderLock  ()
+, m_aiWatchTime   {}
+, m_adWatchChange {}
+, m_asWatchFolder {}
+, m_iWatchHandle  (-1)
+, m_dWatchPoll    (0.0)
+, m_bWatchActive  (false)
+, m_ResourceLock  ()
+, m_FileLock      ()
+, m_bActive       (false)
+{
+    // record lock statistics (only in lock statistics mode)
+    m_ResourceLock.SetName("resource_handle");
+    m_FileLock    .SetName("resource_file");
+    m_QueueLock   .SetName("resource_queue");
+    m_DecodeLock  .SetName("resource_decode");
+    m_ReleaseLock .SetName("resource_release");
+
+    // configure resource thread (sleep while idle, woken up by new load requests)
+    this->SetFrequency  (120.0f);
+    this->SetIdleTimeout(CORE_RESOURCE_IDLE);
 
     // start up the resource manager
     this->Reset(CORE_RESOURCE_RESET_INIT);
@@ -90,6 +157,9 @@ coreResourceManager::coreResourceManager()noexcept
     // load all relevant default resources
     this->__LoadDefault();
 
+    // watch resource files for changes
+    this->SetHotReload(Core::Config->GetBool(CORE_CONFIG_BASE_HOTRELOAD));
+
     Core::Log->Info(CORE_LOG_BOLD("Resource Manager created"));
 }
 
@@ -100,12 +170,31 @@ coreResourceManager::~coreResourceManager()
 {
     ASSERT(m_apRelation.empty())
 
+    // stop manifest recording and prefetching
+    m_bRecording = false;
+    this->ReleaseManifest();
+
+    // stop watching resource files
+    this->SetHotReload(false);
+
+    // release all placeholders
+    FOR_EACH(it, m_apPlaceholder) (*it)->RefDecrease();
+    m_apPlaceholder.clear();
+    m_apDefault    .clear();
+
     // shut down the resource manager
     this->Reset(CORE_RESOURCE_RESET_EXIT);
 
     // reset resource proxies
     FOR_EACH(it, m_apProxy.get_keylist()) this->AssignProxy(*it, NULL);
 
+    // clear load queues
+    for(coreUintW i = 0u; i < CORE_RESOURCE_PRIORITIES; ++i) m_aapQueue[i].clear();
+
+    // clear release list
+    FOR_EACH(it, m_apRelease) (*it)->m_bReleased = false;
+    m_apRelease.clear();
+
     // delete resource handles
     FOR_EACH(it, m_apHandle) MANAGED_DELETE(*it)
 
@@ -117,8 +206,10 @@ coreResourceManager::~coreResourceManager()
     m_apHandle    .clear();
     m_apArchive   .clear();
     m_apDirectFile.clear();
+    m_apFileIndex .clear();
     m_apProxy     .clear();
     m_apRelation  .clear();
+    m_apWaiting   .clear();
 
     Core::Log->Info(CORE_LOG_BOLD("Resource Manager destroyed"));
 }
@@ -128,26 +219,68 @@ coreResourceManager::~coreResourceManager()
 /* update the resource manager */
 void coreResourceManager::UpdateResources()
 {
-    if(m_bActive)
+    // skip idle updates without locking
+    if(m_bActive && m_iQueueNum)
     {
         m_ResourceLock.Lock();
         {
-            // loop through all resource handles
-            for(coreUintW i = 0u; i < m_apHandle.size(); ++i)   // # size may change
+            // handle queued resource handles (highest priority first, re-checked after every load)
+            for(coreResourceHandle* pCurHandle; (pCurHandle = this->__DequeueHandle()); )
             {
-                coreResourceHandle* pCurHandle = m_apHandle[i];
-
                 // check for requirements
                 if(pCurHandle->__CanAutoUpdate())
                 {
+                    if(m_bDecodeActive && this->__IsFileDecoding(pCurHandle->m_pFile))
+                    {
+                        // retry later when the resource file is still used by another decode (file data is shared)
+                        pCurHandle->m_UpdateLock.Unlock();
+                        m_apRetry.push_back(pCurHandle);
+                        continue;
+                    }
+
+                    this->__TrackActive(pCurHandle);
+
+                    if(m_bDecodeActive && pCurHandle->__CanAutoDecode())
+                    {
+                        // collect for batched reading (handed over to decode jobs when read)
+                        this->__AcquireDecodeFile(pCurHandle->m_pFile);
+                        m_apBatch.push_back(pCurHandle);
+                        if(m_apBatch.size() >= CORE_RESOURCE_BATCH) this->__LoadBatch();
+                        continue;
+                    }
+
                     m_ResourceLock.Unlock();
                     {
-                        // update resource handle
+                        // update resource handle (only graphics stage, when already decoded)
+                        const coreUint64 iStart = SDL_GetPerformanceCounter();
                         pCurHandle->__AutoUpdate();
+                        pCurHandle->m_afLoadTime[CORE_RESOURCE_STAGE_UPLOAD] += coreFloat(coreDouble(SDL_GetPerformanceCounter() - iStart) * Core::System->GetPerfFrequency());
                     }
                     m_ResourceLock.Lock();
+
+                    // poll again with the next update when still busy (e.g. waiting on sync object)
+                    if(pCurHandle->IsLoading()) m_apRetry.push_back(pCurHandle);
+                                           else this->__TrackFinished(pCurHandle);
+                    pCurHandle->m_UpdateLock.Unlock();
+                }
+                else if(pCurHandle->IsLoading())
+                {
+                    // retry later when blocked by another update
+                    m_apRetry.push_back(pCurHandle);
+                }
+                else
+                {
+                    // already loaded elsewhere or not referenced anymore
+                    this->__TrackFinished(pCurHandle);
                 }
             }
+
+            // read remaining batch
+            this->__LoadBatch();
+
+            // re-add all unfinished resource handles (without waking up, to poll them with the next regular update)
+            FOR_EACH(it, m_apRetry) this->__EnqueueHandle(*it, false);
+            m_apRetry.clear();
         }
         m_ResourceLock.Unlock();
     }
@@ -161,11 +294,14 @@ coreArchive* coreResourceManager::RetrieveArchive(const coreHashString& sPath)
     coreSpinLocker oLocker(&m_FileLock);
 
     // check for existing archive
-    if(m_apArchive.count_bs(sPath)) return m_apArchive.at_bs(sPath);
+    if(m_apArchive.count(sPath)) return m_apArchive.at(sPath);
 
-    // load new archive
-    coreArchive* pNewArchive = MANAGED_NEW(coreArchive, sPath.GetString());
-    m_apArchive.emplace_bs(sPath, pNewArchive);
+    // load new archive (keep mount order)
+    coreArchive* pNewArchive = MANAGED_NEW(coreArchive, sPath.GetString(), Core::Config->GetBool(CORE_CONFIG_BASE_MAPPEDMODE));
+    m_apArchive.emplace(sPath, pNewArchive);
+
+    // add archive files to the global index
+    this->__BuildFileIndex();
 
     ASSERT(pNewArchive->GetNumFiles())
     return pNewArchive;
@@ -178,18 +314,10 @@ coreFile* coreResourceManager::RetrieveFile(const coreHashString& sPath)
 {
     coreSpinLocker oLocker(&m_FileLock);
 
-    // try to open direct resource file first
-    if(!coreData::FileExists(sPath.GetString()))
+    // check global archive file index (direct resource files are only preferred when configured, to prevent file-system access per lookup)
+    if((!m_bDirectMode || !coreData::FileExists(sPath.GetString())) && m_apFileIndex.count_bs(sPath))
     {
-        // check archives
-        FOR_EACH(it, m_apArchive)
-        {
-            coreFile* pFile = (*it)->GetFile(sPath.GetString());
-            if(pFile) return pFile;
-        }
-
-        // resource file not found
-        WARN_IF(true) {}
+        return m_apFileIndex.at_bs(sPath);
     }
 
     // check for existing direct resource file
@@ -199,6 +327,12 @@ coreFile* coreResourceManager::RetrieveFile(const coreHashString& sPath)
     coreFile* pNewFile = MANAGED_NEW(coreFile, sPath.GetString());
     m_apDirectFile.emplace_bs(sPath, pNewFile);
 
+    // watch for changes
+    if(m_bWatchActive) this->__WatchFile(pNewFile);
+
+    // resource file not found
+    WARN_IF(!pNewFile->GetSize()) {}
+
     return pNewFile;
 }
 
@@ -233,6 +367,293 @@ void coreResourceManager::FolderScan(const coreChar* pcPath, const coreChar* pcF
 }
 
 
+// ****************************************************************
+/* reload resources automatically when their resource files change */
+void coreResourceManager::SetHotReload(const coreBool bEnable)
+{
+    coreSpinLocker oLocker(&m_FileLock);
+
+    // check and set current status
+    if(m_bWatchActive == bEnable) return;
+    m_bWatchActive = bEnable;
+
+    if(m_bWatchActive)
+    {
+#if defined(_CORE_LINUX_)
+
+        // create native file watching instance (without blocking)
+        m_iWatchHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+#endif
+
+        // watch all existing direct resource files
+        FOR_EACH(it, m_apDirectFile) this->__WatchFile(*it);
+        m_dWatchPoll = Core::System->GetTotalTime();
+
+        Core::Log->Info("Hot-reloading enabled (%s)", (m_iWatchHandle >= 0) ? "native" : "polling");
+    }
+    else
+    {
+#if defined(_CORE_LINUX_)
+
+        // delete native file watching instance (removes all watches)
+        if(m_iWatchHandle >= 0) close(m_iWatchHandle);
+
+#endif
+
+        // clear memory
+        m_aiWatchTime  .clear();
+        m_adWatchChange.clear();
+        m_asWatchFolder.clear();
+        m_iWatchHandle = -1;
+    }
+}
+
+
+// ****************************************************************
+/* get current loading progress */
+coreResourceProgress coreResourceManager::GetProgress()
+{
+    coreSpinLocker oLocker(&m_TrackLock);
+
+    coreResourceProgress oProgress;
+    oProgress.iQueued     = m_iTrackQueued;
+    oProgress.iActive     = m_iTrackActive;
+    oProgress.iDone       = m_iTrackDone;
+    oProgress.iBytesTotal = m_iTrackBytesTotal;
+    oProgress.iBytesDone  = m_iTrackBytesDone;
+
+    // calculate finished part
+    const coreUint32 iTotal = m_iTrackQueued + m_iTrackActive + m_iTrackDone;
+    if(m_iTrackBytesTotal) oProgress.fProgress = coreFloat(coreDouble(m_iTrackBytesDone) / coreDouble(m_iTrackBytesTotal));
+    else if(iTotal)        oProgress.fProgress = I_TO_F(m_iTrackDone) / I_TO_F(iTotal);
+    else                   oProgress.fProgress = 1.0f;
+
+    // estimate remaining time from the throughput since loading started
+    if(!m_iTrackQueued && !m_iTrackActive) oProgress.fEstimate = 0.0f;
+    else if(oProgress.fProgress <= 0.0f)   oProgress.fEstimate = -1.0f;
+    else
+    {
+        const coreDouble dElapsed = coreDouble(SDL_GetPerformanceCounter() - m_iTrackStart) * Core::System->GetPerfFrequency();
+        oProgress.fEstimate = coreFloat(dElapsed * coreDouble(1.0f - oProgress.fProgress) / coreDouble(oProgress.fProgress));
+    }
+
+    return oProgress;
+}
+
+
+// ****************************************************************
+/* export load times of all resources */
+coreStatus coreResourceManager::SaveLoadTimes(const coreChar* pcPath)
+{
+    coreList<coreResourceHandle*> apHandle;
+
+    m_ResourceLock.LockRead();
+    {
+        // collect all resource handles which have been loaded
+        FOR_EACH(it, m_apHandle) if((*it)->m_fLoadLatency > 0.0f) apHandle.push_back(*it);
+    }
+    m_ResourceLock.UnlockRead();
+
+    // sort by total work (slowest first)
+    const auto nTotalFunc = [](const coreResourceHandle* pHandle)
+    {
+        return pHandle->m_afLoadTime[CORE_RESOURCE_STAGE_READ] + pHandle->m_afLoadTime[CORE_RESOURCE_STAGE_DECODE] + pHandle->m_afLoadTime[CORE_RESOURCE_STAGE_UPLOAD];
+    };
+    std::sort(apHandle.begin(), apHandle.end(), [&](const coreResourceHandle* A, const coreResourceHandle* B)
+    {
+        return (nTotalFunc(A) > nTotalFunc(B));
+    });
+
+    // write one resource per line (times in milliseconds)
+    coreString sBuffer = "name;size;read;decode;upload;latency\n";
+    FOR_EACH(it, apHandle)
+    {
+        const coreResourceHandle* pHandle = (*it);
+        sBuffer.append(PRINT("%s;%u;%.3f;%.3f;%.3f;%.3f\n", pHandle->GetName(), pHandle->m_pFile ? pHandle->m_pFile->GetSize() : 0u,
+                             pHandle->m_afLoadTime[CORE_RESOURCE_STAGE_READ]   * 1000.0f,
+                             pHandle->m_afLoadTime[CORE_RESOURCE_STAGE_DECODE] * 1000.0f,
+                             pHandle->m_afLoadTime[CORE_RESOURCE_STAGE_UPLOAD] * 1000.0f,
+                             pHandle->m_fLoadLatency                           * 1000.0f));
+    }
+
+    // create file data
+    coreByte* pData = new coreByte[sBuffer.length()];
+    std::memcpy(pData, sBuffer.c_str(), sBuffer.length());
+
+    // save load times
+    coreFile oFile(pcPath, pData, sBuffer.length());
+    if(oFile.Save())
+    {
+        Core::Log->Warning("Load times (%s) could not be saved", pcPath);
+        return CORE_ERROR_FILE;
+    }
+
+    Core::Log->Info("Load times (%s, %u resources) saved", pcPath, coreUint32(apHandle.size()));
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* start recording a resource manifest */
+void coreResourceManager::StartManifest()
+{
+    coreSpinLocker oLocker(&m_RecordLock);
+
+    // reset previous recording
+    m_asRecord    .clear();
+    m_aiRecordHash.clear();
+    m_bRecording = true;
+}
+
+
+// ****************************************************************
+/* stop recording and save resource manifest */
+coreStatus coreResourceManager::EndManifest(const coreChar* pcPath)
+{
+    coreString sBuffer;
+    coreUintW  iNum;
+
+    m_RecordLock.Lock();
+    {
+        WARN_IF(!m_bRecording)
+        {
+            m_RecordLock.Unlock();
+            return CORE_INVALID_CALL;
+        }
+
+        // write one resource name per line
+        FOR_EACH(it, m_asRecord) sBuffer.append(PRINT("%s\n", it->c_str()));
+        iNum = m_asRecord.size();
+
+        // stop recording
+        m_asRecord    .clear();
+        m_aiRecordHash.clear();
+        m_bRecording = false;
+    }
+    m_RecordLock.Unlock();
+
+    if(sBuffer.empty()) return CORE_INVALID_DATA;
+
+    // create file data
+    coreByte* pData = new coreByte[sBuffer.length()];
+    std::memcpy(pData, sBuffer.c_str(), sBuffer.length());
+
+    // save manifest file
+    coreFile oFile(pcPath, pData, sBuffer.length());
+    if(oFile.Save())
+    {
+        Core::Log->Warning("Manifest (%s) could not be saved", pcPath);
+        return CORE_ERROR_FILE;
+    }
+
+    Core::Log->Info("Manifest (%s, %u resources) saved", pcPath, coreUint32(iNum));
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* reference all resources listed in a manifest */
+coreStatus coreResourceManager::PrefetchManifest(const coreChar* pcPath)
+{
+    // load manifest file
+    coreFile oFile(pcPath);
+
+    // get file data
+    const coreChar* pcData = r_cast<const coreChar*>(oFile.GetData());
+    if(!pcData)
+    {
+        Core::Log->Warning("Manifest (%s) could not be loaded", pcPath);
+        return CORE_ERROR_FILE;
+    }
+
+    // collect existing resource handles (unknown or unloadable entries are skipped)
+    coreList<coreResourceHandle*> apHandle;
+    coreString sName;
+    m_ResourceLock.LockRead();
+    {
+        const auto& apHandleMap = m_apHandle;   // # const lookups, to not change the shared map
+
+        for(const coreChar* pcCur = pcData, *pcEnd = pcData + oFile.GetSize(); pcCur < pcEnd; )
+        {
+            const coreChar* pcNext = std::find(pcCur, pcEnd, '\n');
+
+            sName.assign(pcCur, pcNext - pcCur);
+            sName.trim();
+
+            const auto it = sName.empty() ? apHandleMap.end() : apHandleMap.find_bs(sName.c_str());
+            if(it != apHandleMap.end())
+            {
+                coreResourceHandle* pHandle = (*it);
+                if(pHandle->m_bAutomatic && pHandle->m_pFile) apHandle.push_back(pHandle);
+            }
+
+            pcCur = pcNext + 1u;
+        }
+    }
+    m_ResourceLock.UnlockRead();
+
+    // rank archives by their first use (identified by mount index, direct files share the index behind all archives)
+    coreList<std::pair<coreUintW, coreResourceHandle*>> aEntry;
+    coreList<coreUintW> aiMount;
+    m_FileLock.Lock();
+    {
+        const auto& apArchive = m_apArchive.get_valuelist();
+        FOR_EACH(it, apHandle)
+        {
+            const coreUintW iMount = std::find(apArchive.begin(), apArchive.end(), (*it)->m_pFile->GetArchive()) - apArchive.begin();
+
+            auto et = std::find(aiMount.begin(), aiMount.end(), iMount);
+            if(et == aiMount.end()) et = aiMount.insert(et, iMount);
+
+            aEntry.emplace_back(et - aiMount.begin(), (*it));
+        }
+    }
+    m_FileLock.Unlock();
+
+    // sort by archive and data position (to request all reads in file order, first-use order between archives and for direct files)
+    std::stable_sort(aEntry.begin(), aEntry.end(), [](const auto& A, const auto& B)
+    {
+        if(A.first != B.first) return (A.first < B.first);
+        return A.second->m_pFile->GetArchive() && (A.second->m_pFile->GetArchivePos() < B.second->m_pFile->GetArchivePos());
+    });
+
+    // apply sorted order
+    for(coreUintW i = 0u, ie = aEntry.size(); i < ie; ++i) apHandle[i] = aEntry[i].second;
+
+    // reference all resources (requests loading in this order)
+    FOR_EACH(it, apHandle) (*it)->RefIncrease();
+
+    m_ResourceLock.Lock();
+    {
+        // remember references for releasing
+        m_apPrefetch.insert(m_apPrefetch.end(), apHandle.begin(), apHandle.end());
+    }
+    m_ResourceLock.Unlock();
+
+    Core::Log->Info("Manifest (%s, %u resources) prefetched", pcPath, coreUint32(apHandle.size()));
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* release all prefetched resources */
+void coreResourceManager::ReleaseManifest()
+{
+    coreList<coreResourceHandle*> apHandle;
+
+    m_ResourceLock.Lock();
+    {
+        // take over all references
+        apHandle.swap(m_apPrefetch);
+    }
+    m_ResourceLock.Unlock();
+
+    // release references (unloaded later when unused)
+    FOR_EACH(it, apHandle) (*it)->RefDecrease();
+}
+
+
 // ****************************************************************
 /* point resource proxy to foreign handle */
 void coreResourceManager::AssignProxy(coreResourceHandle* pProxy, coreResourceHandle* pForeign)
@@ -274,7 +695,8 @@ void coreResourceManager::Reset(const coreResourceReset eInit)
     m_bActive = bActive;
 
     // copy list with relation-objects (container may change)
-    const coreSet<coreResourceRelation*> apRelationCopy = m_apRelation;
+    coreList<coreResourceRelation*, coreFrameAlloc<coreResourceRelation*>> apRelationCopy;
+    apRelationCopy.assign(m_apRelation.begin(), m_apRelation.end());
 
     if(m_bActive)
     {
@@ -288,18 +710,32 @@ void coreResourceManager::Reset(const coreResourceReset eInit)
 
         // start resource thread
         if(Core::Graphics->GetResourceContext())
+        {
+            this->__StartDecoding();
             this->StartThread();
+        }
     }
     else
     {
         // kill resource thread
         if(Core::Graphics->GetResourceContext())
+        {
             this->KillThread();
+            this->__StopDecoding();
+        }
 
         // shut down relation-objects
         FOR_EACH(it, apRelationCopy)
             if(m_apRelation.count_bs(*it)) (*it)->__Reset(CORE_RESOURCE_RESET_EXIT);
 
+        // clear release list
+        m_ReleaseLock.Lock();
+        {
+            FOR_EACH(it, m_apRelease) (*it)->m_bReleased = false;
+            m_apRelease.clear();
+        }
+        m_ReleaseLock.Unlock();
+
         // unload all resources
         FOR_EACH(it, m_apHandle)
             (*it)->Nullify();
@@ -321,7 +757,8 @@ void coreResourceManager::Reset()
 void coreResourceManager::Reshape()
 {
     // copy list with relation-objects (container may change)
-    const coreSet<coreResourceRelation*> apRelationCopy = m_apRelation;
+    coreList<coreResourceRelation*, coreFrameAlloc<coreResourceRelation*>> apRelationCopy;
+    apRelationCopy.assign(m_apRelation.begin(), m_apRelation.end());
 
     // reshape relation-objects
     FOR_EACH(it, apRelationCopy)
@@ -386,6 +823,642 @@ void coreResourceManager::__ExitThread()
 }
 
 
+// ****************************************************************
+/* unload unreferenced resources */
+void coreResourceManager::__UpdateUnload(const coreBool bForce)
+{
+    coreList<coreResourceHandle*, coreFrameAlloc<coreResourceHandle*>> apUnload;
+
+    // get current memory budget (0 = unload everything after the grace window)
+    const coreDouble dTime   = Core::System->GetTotalTime();
+    const coreUintW  iBudget = coreUintW(MAX(Core::Config->GetInt(CORE_CONFIG_BASE_RESOURCEBUDGET), 0)) * 1024u * 1024u;
+    coreUintW        iUsage  = m_iMemoryUsage;
+
+    m_ReleaseLock.Lock();
+    {
+        if(m_apRelease.empty())
+        {
+            m_ReleaseLock.Unlock();
+            return;
+        }
+
+        // remove resource handles which are referenced again
+        std::erase_if(m_apRelease, [](coreResourceHandle* pHandle)
+        {
+            if(!pHandle->m_iRefCount) return false;
+            pHandle->m_bReleased = false;
+            return true;
+        });
+
+        // sort by last use (least recently used first)
+        std::sort(m_apRelease.begin(), m_apRelease.end(), [](const coreResourceHandle* A, const coreResourceHandle* B)
+        {
+            return (A->m_dReleaseTime < B->m_dReleaseTime);
+        });
+
+        // select resource handles to unload
+        FOR_EACH(it, m_apRelease)
+        {
+            if(!bForce)
+            {
+                // keep recently used resources and stay within the budget
+                if((dTime - (*it)->m_dReleaseTime) < CORE_RESOURCE_GRACE) break;
+                if(iBudget && (iUsage <= iBudget))                        break;
+            }
+
+            iUsage -= MIN((*it)->m_iMemorySize, iUsage);
+            (*it)->m_bReleased = false;
+
+            apUnload.push_back(*it);
+        }
+        m_apRelease.erase(m_apRelease.begin(), m_apRelease.begin() + apUnload.size());
+    }
+    m_ReleaseLock.Unlock();
+
+    // unload all selected resources (outside of the lock)
+    FOR_EACH(it, apUnload)
+    {
+        if(!(*it)->m_iRefCount) (*it)->Nullify();
+    }
+}
+
+
+// ****************************************************************
+/* add unreferenced resource handle to the release list */
+void coreResourceManager::__ReleaseHandle(coreResourceHandle* pHandle)
+{
+    coreSpinLocker oLocker(&m_ReleaseLock);
+
+    // update time of last use
+    pHandle->m_dReleaseTime = Core::System->GetTotalTime();
+
+    if(!pHandle->m_bReleased)
+    {
+        pHandle->m_bReleased = true;
+        m_apRelease.push_back(pHandle);
+    }
+}
+
+
+// ****************************************************************
+/* start handing over resource handles to decode jobs */
+void coreResourceManager::__StartDecoding()
+{
+    ASSERT(!m_bDecodeActive)
+
+    // only use decode jobs if they can run in parallel to the resource thread
+    m_bDecodeActive = (Core::Manager::Job->GetNumWorkers() != 0u);
+}
+
+
+// ****************************************************************
+/* stop handing over resource handles to decode jobs */
+void coreResourceManager::__StopDecoding()
+{
+    m_bDecodeActive = false;
+
+    // wait for all decode jobs to finish (and help executing)
+    Core::Manager::Job->Wait(&m_DecodeCounter);
+
+    // release all remaining resource handles (# keep order with the acquired update-lock)
+    FOR_EACH(it, m_apDecode)
+    {
+        if((*it)->IsLoading()) this->__EnqueueHandle(*it);
+        (*it)->m_UpdateLock.Unlock();
+    }
+    m_apDecode    .clear();
+    m_apDecodeFile.clear();
+    m_iDecodeNum = 0u;
+}
+
+
+// ****************************************************************
+/* read file data of collected resource handles and hand them over to decode jobs */
+void coreResourceManager::__LoadBatch()
+{
+    ASSERT(m_ResourceLock.IsLocked())
+
+    if(m_apBatch.empty()) return;
+
+    // collect resource files
+    coreList<coreFile*> apFile;
+    apFile.reserve(m_apBatch.size());
+    FOR_EACH(it, m_apBatch) apFile.push_back((*it)->m_pFile);
+
+    m_ResourceLock.Unlock();
+    {
+        coreUint64 iLast = SDL_GetPerformanceCounter();
+
+        // read all files at once (concurrently, decoding can already start while the rest is read)
+        coreFile::LoadDataBatch(apFile, [&](const coreUintW iIndex, const coreStatus eStatus)
+        {
+            // hand over to decode jobs (added again when finished, errors are handled while decoding)
+            m_DecodeLock.Lock();
+            {
+                // measure reading duration since the previous file (called from different threads)
+                const coreUint64 iNow = SDL_GetPerformanceCounter();
+                m_apBatch[iIndex]->m_afLoadTime[CORE_RESOURCE_STAGE_READ] += coreFloat(coreDouble(iNow - iLast) * Core::System->GetPerfFrequency());
+                iLast = iNow;
+
+                m_apDecode.push_back(m_apBatch[iIndex]);
+                m_iDecodeNum.FetchAdd(1u);
+            }
+            m_DecodeLock.Unlock();
+
+            // submit decode job (always takes the oldest resource handle, to keep the read order)
+            Core::Manager::Job->Submit([this]() {this->__DecodeResources();}, &m_DecodeCounter);
+        });
+    }
+    m_ResourceLock.Lock();
+
+    m_apBatch.clear();
+}
+
+
+// ****************************************************************
+/* decode next waiting resource handle */
+void coreResourceManager::__DecodeResources()
+{
+    // skip without locking
+    if(!m_iDecodeNum) return;
+
+    coreResourceHandle* pHandle;
+
+    m_DecodeLock.Lock();
+    {
+        if(m_apDecode.empty())
+        {
+            m_DecodeLock.Unlock();
+            return;
+        }
+
+        // take oldest resource handle (in read order, batches are dequeued by priority)
+        pHandle = m_apDecode.front();
+        m_apDecode.pop_front();
+        m_iDecodeNum.FetchSub(1u);
+    }
+    m_DecodeLock.Unlock();
+
+    // decode resource data and release the update-lock
+    pHandle->__AutoDecode();
+}
+
+
+// ****************************************************************
+/* check whether the resource file is currently used for reading or decoding */
+coreBool coreResourceManager::__IsFileDecoding(coreFile* pFile)
+{
+    if(!pFile) return false;
+
+    coreSpinLocker oLocker(&m_DecodeLock);
+    return m_apDecodeFile.count_bs(pFile);
+}
+
+
+// ****************************************************************
+/* mark resource file as used until decoding is finished */
+void coreResourceManager::__AcquireDecodeFile(coreFile* pFile)
+{
+    ASSERT(pFile)
+
+    coreSpinLocker oLocker(&m_DecodeLock);
+    m_apDecodeFile.insert_bs(pFile);
+}
+
+
+// ****************************************************************
+/* release resource file after decoding */
+void coreResourceManager::__ReleaseDecodeFile(coreFile* pFile)
+{
+    m_DecodeLock.Lock();
+    {
+        m_apDecodeFile.erase_bs(pFile);
+    }
+    m_DecodeLock.Unlock();
+
+    // wake up resource thread (other resource handles may wait for this resource file)
+    this->WakeUp();
+}
+
+
+// ****************************************************************
+/* reload resources with changed resource files */
+void coreResourceManager::__ProcessWatch()
+{
+    coreList<coreFile*,           coreFrameAlloc<coreFile*>>           apChanged;
+    coreList<coreResourceHandle*, coreFrameAlloc<coreResourceHandle*>> apHandle;
+    coreList<coreResourceHandle*, coreFrameAlloc<coreResourceHandle*>> apReloaded;
+
+    const coreDouble dTime = Core::System->GetTotalTime();
+
+    m_FileLock.Lock();
+    {
+#if defined(_CORE_LINUX_)
+
+        if(m_iWatchHandle >= 0)
+        {
+            alignas(inotify_event) coreChar acBuffer[0x1000u];
+
+            // read all pending change events
+            for(ssize_t iRead; (iRead = read(m_iWatchHandle, acBuffer, ARRAY_SIZE(acBuffer))) > 0; )
+            {
+                for(ssize_t i = 0; i < iRead; )
+                {
+                    const inotify_event* pEvent = r_cast<const inotify_event*>(acBuffer + i);
+                    i += sizeof(inotify_event) + pEvent->len;
+
+                    if(!pEvent->len || !m_asWatchFolder.count_bs(pEvent->wd)) continue;
+
+                    // check for watched resource file
+                    const coreString& sFolder = m_asWatchFolder.at_bs(pEvent->wd);
+                    const coreChar*   pcPath  = sFolder.empty() ? pEvent->name : PRINT("%s/%s", sFolder.c_str(), pEvent->name);
+                    if(!m_apDirectFile.count_bs(pcPath)) continue;
+
+                    // delay reloading until all changes are written
+                    m_adWatchChange[m_apDirectFile.at_bs(pcPath)] = dTime;
+                }
+            }
+        }
+        else
+
+#endif
+
+        if(dTime - m_dWatchPoll >= CORE_RESOURCE_POLL)
+        {
+            m_dWatchPoll = dTime;
+
+            // compare write times of all watched resource files
+            FOR_EACH(it, m_aiWatchTime)
+            {
+                coreFile* pFile = (*m_aiWatchTime.get_key(it));
+
+                const std::time_t iTime = coreData::FileWriteTime(pFile->GetPath());
+                if(iTime != (*it))
+                {
+                    (*it) = iTime;
+                    m_adWatchChange[pFile] = dTime;
+                }
+            }
+        }
+
+        // collect settled resource files
+        for(auto it = m_adWatchChange.begin(); it != m_adWatchChange.end(); )
+        {
+            if(dTime - (*it) >= CORE_RESOURCE_SETTLE)
+            {
+                apChanged.push_back(*m_adWatchChange.get_key(it));
+                it = m_adWatchChange.erase(it);
+            }
+            else ++it;
+        }
+    }
+    m_FileLock.Unlock();
+
+    if(apChanged.empty()) return;
+
+    FOR_EACH(it, apChanged)
+    {
+        coreFile* pFile = (*it);
+
+        m_ResourceLock.LockRead();
+        {
+            // collect all resource handles using the resource file
+            apHandle.clear();
+            FOR_EACH(et, m_apHandle) if((*et)->m_pFile == pFile) apHandle.push_back(*et);
+        }
+        m_ResourceLock.UnlockRead();
+
+        // retry later while the resource file is in use by the loader
+        if(std::any_of(apHandle.begin(), apHandle.end(), [](const coreResourceHandle* pHandle) {return pHandle->IsLoading();}))
+        {
+            coreSpinLocker oLocker(&m_FileLock);
+            m_adWatchChange[pFile] = dTime;
+            continue;
+        }
+
+        // re-read resource file and reload resources
+        pFile->Refresh();
+        FOR_EACH(et, apHandle) if((*et)->Reload()) apReloaded.push_back(*et);
+
+        Core::Log->Info("Resource file (%s) changed", pFile->GetPath());
+    }
+
+    const coreUintW iReloaded = apReloaded.size();
+    if(iReloaded)
+    {
+        const auto nIsAffected = [&](const auto& nDependent)
+        {
+            return std::any_of(apReloaded.begin(), apReloaded.end(), nDependent);
+        };
+
+        m_ResourceLock.LockRead();
+        {
+            // collect derived resources depending on reloaded resources (e.g. programs, which have to be linked again with reloaded shaders)
+            apHandle.clear();
+            FOR_EACH(it, m_apHandle)
+            {
+                const coreResourceHandle* pDerived = (*it);
+                if(!pDerived->m_pFile && pDerived->m_bAutomatic && pDerived->IsLoaded() && nIsAffected([&](const coreResourceHandle* pHandle) {return pDerived->m_pResource->IsDependent(pHandle);}))
+                {
+                    apHandle.push_back(*it);
+                }
+            }
+        }
+        m_ResourceLock.UnlockRead();
+
+        // load derived resources again (through the load queue)
+        FOR_EACH(it, apHandle) (*it)->Nullify();
+        apReloaded.insert(apReloaded.end(), apHandle.begin(), apHandle.end());
+
+        // copy list with relation-objects (container may change)
+        coreList<coreResourceRelation*, coreFrameAlloc<coreResourceRelation*>> apRelationCopy;
+        apRelationCopy.assign(m_apRelation.begin(), m_apRelation.end());
+
+        // notify relation-objects depending on affected resources
+        FOR_EACH(it, apRelationCopy)
+        {
+            const coreResourceRelation* pRelation = (*it);
+            if(m_apRelation.count_bs(*it) && nIsAffected([&](const coreResourceHandle* pHandle) {return pRelation->__IsDependent(pHandle);})) (*it)->__Reshape();
+        }
+
+        Core::Log->Info("%u resources hot-reloaded", coreUint32(iReloaded));
+    }
+}
+
+
+// ****************************************************************
+/* start watching a direct resource file */
+void coreResourceManager::__WatchFile(coreFile* pFile)
+{
+    ASSERT(m_FileLock.IsLocked())
+
+    // remember current write time (for polling)
+    if(!m_aiWatchTime.count_bs(pFile)) m_aiWatchTime.emplace_bs(pFile, coreData::FileWriteTime(pFile->GetPath()));
+
+#if defined(_CORE_LINUX_)
+
+    if(m_iWatchHandle >= 0)
+    {
+        // extract folder of the resource file (files are often replaced instead of modified, so the whole folder is watched)
+        const coreChar* pcPath   = pFile->GetPath();
+        const coreChar* pcSlash  = std::strrchr(pcPath, '/');
+        const coreString sFolder(pcPath, pcSlash ? (pcSlash - pcPath) : 0);
+
+        // add watch for completed writes and renames into the folder
+        const coreInt32 iWatch = inotify_add_watch(m_iWatchHandle, sFolder.empty() ? "." : sFolder.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if(iWatch < 0)
+        {
+            Core::Log->Warning("Folder (%s) could not be watched", sFolder.c_str());
+            return;
+        }
+
+        if(!m_asWatchFolder.count_bs(iWatch)) m_asWatchFolder.emplace_bs(iWatch, sFolder);
+    }
+
+#endif
+}
+
+
+// ****************************************************************
+/* switch to real resources which finished loading */
+void coreResourceManager::__SwapPlaceholder()
+{
+    coreSpinLocker oLocker(&m_PlaceholderLock);
+
+    // only called at frame boundaries (every frame renders consistently with either the placeholder or the real resource)
+    std::erase_if(m_apWaiting, [](coreResourceHandle* pHandle)
+    {
+        if(pHandle->IsLoaded()) pHandle->m_bReady = true;
+        else if(pHandle->m_iRefCount) return false;
+
+        // remove loaded and unreferenced resource handles (added again when requested)
+        pHandle->m_bWaiting = false;
+        return true;
+    });
+
+    m_iWaitingNum = m_apWaiting.size();
+}
+
+
+// ****************************************************************
+/* keep placeholder loaded */
+void coreResourceManager::__BindPlaceholder(coreResourceHandle* pPlaceholder)
+{
+    ASSERT(!pPlaceholder->m_pPlaceholder)
+
+    coreSpinLocker oLocker(&m_PlaceholderLock);
+
+    // reference every placeholder once (until shut down)
+    if(std::find(m_apPlaceholder.begin(), m_apPlaceholder.end(), pPlaceholder) == m_apPlaceholder.end())
+    {
+        m_apPlaceholder.push_back(pPlaceholder);
+        pPlaceholder->RefIncrease();
+    }
+}
+
+
+// ****************************************************************
+/* set default placeholder for new resources of a type */
+void coreResourceManager::__SetDefault(const coreUint32 iTypeId, coreResourceHandle* pPlaceholder)
+{
+    coreSpinLocker oLocker(&m_PlaceholderLock);
+
+    if(pPlaceholder) m_apDefault.bs(iTypeId) = pPlaceholder;
+                else m_apDefault.erase_bs(iTypeId);
+}
+
+
+// ****************************************************************
+/* get default placeholder for new resources of a type */
+coreResourceHandle* coreResourceManager::__GetDefault(const coreUint32 iTypeId)
+{
+    coreSpinLocker oLocker(&m_PlaceholderLock);
+
+    return m_apDefault.count_bs(iTypeId) ? m_apDefault.at_bs(iTypeId) : NULL;
+}
+
+
+// ****************************************************************
+/* serve placeholder until the real resource is loaded */
+void coreResourceManager::__WaitPlaceholder(coreResourceHandle* pHandle)
+{
+    coreSpinLocker oLocker(&m_PlaceholderLock);
+
+    pHandle->m_bReady = false;
+
+    if(!pHandle->m_bWaiting)
+    {
+        pHandle->m_bWaiting = true;
+        m_apWaiting.push_back(pHandle);
+        m_iWaitingNum.FetchAdd(1u);
+    }
+}
+
+
+// ****************************************************************
+/* track new load request */
+void coreResourceManager::__TrackQueued(coreResourceHandle* pHandle)
+{
+    coreSpinLocker oLocker(&m_TrackLock);
+
+    // ignore re-added resource handles
+    if(pHandle->m_iTrackState) return;
+
+    const coreUint64 iTime = SDL_GetPerformanceCounter();
+
+    // start new loading phase when idle
+    if(!m_iTrackQueued && !m_iTrackActive)
+    {
+        m_iTrackDone       = 0u;
+        m_iTrackBytesTotal = 0u;
+        m_iTrackBytesDone  = 0u;
+        m_iTrackStart      = iTime;
+    }
+
+    // reset load times
+    pHandle->m_iTrackState  = 1u;
+    pHandle->m_iTrackStart  = iTime;
+    pHandle->m_fLoadLatency = 0.0f;
+    std::memset(pHandle->m_afLoadTime, 0, sizeof(pHandle->m_afLoadTime));
+
+    m_iTrackQueued     += 1u;
+    m_iTrackBytesTotal += pHandle->m_pFile ? pHandle->m_pFile->GetSize() : 0u;
+}
+
+
+// ****************************************************************
+/* track start of loading */
+void coreResourceManager::__TrackActive(coreResourceHandle* pHandle)
+{
+    coreSpinLocker oLocker(&m_TrackLock);
+
+    if(pHandle->m_iTrackState == 1u)
+    {
+        pHandle->m_iTrackState = 2u;
+
+        m_iTrackQueued -= 1u;
+        m_iTrackActive += 1u;
+    }
+}
+
+
+// ****************************************************************
+/* track end of loading (completed, failed or cancelled) */
+void coreResourceManager::__TrackFinished(coreResourceHandle* pHandle)
+{
+    coreSpinLocker oLocker(&m_TrackLock);
+
+    if(pHandle->m_iTrackState)
+    {
+        if(pHandle->m_iTrackState == 1u) m_iTrackQueued -= 1u;
+                                    else m_iTrackActive -= 1u;
+
+        pHandle->m_iTrackState  = 0u;
+        pHandle->m_fLoadLatency = coreFloat(coreDouble(SDL_GetPerformanceCounter() - pHandle->m_iTrackStart) * Core::System->GetPerfFrequency());
+
+        m_iTrackDone      += 1u;
+        m_iTrackBytesDone += pHandle->m_pFile ? pHandle->m_pFile->GetSize() : 0u;
+    }
+}
+
+
+// ****************************************************************
+/* record resource handle into the current manifest */
+void coreResourceManager::__RecordHandle(const coreResourceHandle* pHandle)
+{
+    // only record resources which can be prefetched
+    if(!pHandle->m_bAutomatic || !pHandle->m_pFile) return;
+
+    const coreUint32 iHash = coreHashString(pHandle->GetName());
+
+    coreSpinLocker oLocker(&m_RecordLock);
+
+    // add name on first use
+    if(m_bRecording && !m_aiRecordHash.count_bs(iHash))
+    {
+        m_aiRecordHash.insert_bs(iHash);
+        m_asRecord    .push_back(pHandle->GetName());
+    }
+}
+
+
+// ****************************************************************
+/* add resource handle to the load queue */
+void coreResourceManager::__EnqueueHandle(coreResourceHandle* pHandle, const coreBool bWake)
+{
+    ASSERT(pHandle->m_bAutomatic)
+
+    // serve placeholder until loaded (only handles which are actually requested)
+    if(pHandle->m_pPlaceholder) this->__WaitPlaceholder(pHandle);
+
+    coreSpinLocker oLocker(&m_QueueLock);
+
+    if(!pHandle->m_bQueued)
+    {
+        // track loading progress (only new requests)
+        this->__TrackQueued(pHandle);
+
+        // append to the queue of the current priority
+        pHandle->m_bQueued = true;
+        m_aapQueue[pHandle->m_ePriority].push_back(pHandle);
+        m_iQueueNum.FetchAdd(1u);
+
+        // wake up resource thread
+        if(bWake) this->WakeUp();
+    }
+}
+
+
+// ****************************************************************
+/* take next resource handle from the load queue */
+coreResourceHandle* coreResourceManager::__DequeueHandle()
+{
+    coreSpinLocker oLocker(&m_QueueLock);
+
+    for(coreUintW i = 0u; i < CORE_RESOURCE_PRIORITIES; ++i)
+    {
+        coreList<coreResourceHandle*>& apQueue = m_aapQueue[i];
+        coreUintW&                     iHead   = m_aiQueueHead[i];
+
+        while(iHead < apQueue.size())
+        {
+            coreResourceHandle* pHandle = apQueue[iHead++];
+            m_iQueueNum.FetchSub(1u);
+
+            // skip removed and moved entries
+            if(!pHandle || !pHandle->m_bQueued || (pHandle->m_ePriority != i)) continue;
+
+            pHandle->m_bQueued = false;
+            return pHandle;
+        }
+
+        // recycle exhausted queue
+        apQueue.clear();
+        iHead = 0u;
+    }
+
+    return NULL;
+}
+
+
+// ****************************************************************
+/* remove resource handle from the load queue */
+void coreResourceManager::__RemoveHandle(const coreResourceHandle* pHandle)
+{
+    coreSpinLocker oLocker(&m_QueueLock);
+
+    // invalidate all entries (skipped when dequeued)
+    for(coreUintW i = 0u; i < CORE_RESOURCE_PRIORITIES; ++i)
+    {
+        std::replace_if(m_aapQueue[i].begin() + m_aiQueueHead[i], m_aapQueue[i].end(), [&](const coreResourceHandle* pEntry) {return (pEntry == pHandle);}, NULL);
+    }
+
+    // remove from unfinished resource handles (# protected by resource lock)
+    ASSERT(m_ResourceLock.IsLocked())
+    std::erase(m_apRetry, pHandle);
+}
+
+
 // ****************************************************************
 /* load all relevant default resources */
 void coreResourceManager::__LoadDefault()
@@ -404,6 +1477,11 @@ void coreResourceManager::__LoadDefault()
     this->Load<coreShader> ("default_particle.vert",     CORE_RESOURCE_UPDATE_MANUAL, "data/shaders/default_particle.vert");
     this->Load<coreShader> ("default_particle.frag",     CORE_RESOURCE_UPDATE_MANUAL, "data/shaders/default_particle.frag");
     this->Load<coreFont>   ("default.ttf",               CORE_RESOURCE_UPDATE_AUTO,   "data/fonts/default.ttf");
+    this->Load<coreModel>  ("default_cube.md3",          CORE_RESOURCE_UPDATE_AUTO,   "data/models/default_cube.md3");
+
+    // serve default resources while still loading (programs differ in their inputs, and have to be assigned per resource handle)
+    this->SetPlaceholder<coreTexture>("default_white.png");
+    this->SetPlaceholder<coreModel>  ("default_cube.md3");
 
     d_cast<coreProgram*>(this->Load<coreProgram>("default_2d_program", CORE_RESOURCE_UPDATE_AUTO, NULL)->GetRawResource())
         ->AttachShader  (this->Get <coreShader> ("default_2d.vert"))
@@ -436,4 +1514,44 @@ void coreResourceManager::__LoadDefault()
         ->Finish();
 
     Core::Log->Info("Default resources loaded");
-}
\ No newline at end of file
+}
+
+
+// ****************************************************************
+/* rebuild global archive file index */
+void coreResourceManager::__BuildFileIndex()
+{
+    // collect files of all archives (later mounted archives first, to override earlier ones)
+    coreList<std::pair<coreUint32, coreFile*>> aEntry;
+    for(coreUintW i = m_apArchive.size(); i--; )
+    {
+        coreArchive* pArchive = m_apArchive.get_valuelist()[i];
+        for(coreUintW j = 0u, je = pArchive->GetNumFiles(); j < je; ++j)
+        {
+            coreFile* pFile = pArchive->GetFile(j);
+            aEntry.emplace_back(coreHashString(pFile->GetPath()).GetHash(), pFile);
+        }
+    }
+
+    // sort by path hash (stable, to keep override order)
+    std::stable_sort(aEntry.begin(), aEntry.end(), [](const std::pair<coreUint32, coreFile*>& A, const std::pair<coreUint32, coreFile*>& B)
+    {
+        return (A.first < B.first);
+    });
+
+    // create index with highest-priority entry per path
+    m_apFileIndex.clear();
+    m_apFileIndex.reserve(aEntry.size());
+    FOR_EACH(it, aEntry)
+    {
+        if(!m_apFileIndex.empty() && (m_apFileIndex.get_keylist().back() == it->first))
+        {
+            ASSERT(!std::strcmp(m_apFileIndex.back()->GetPath(), it->second->GetPath()))
+            continue;
+        }
+
+        m_apFileIndex.emplace_bs(it->first, it->second);   // # appends, already sorted
+    }
+
+    Core::Log->Info("Archive file index built (%u files, %u archives)", coreUint32(m_apFileIndex.size()), coreUint32(m_apArchive.size()));
+}
@@ -13,12 +13,17 @@
 // TODO 3: call OnLoad directly after load instead with delayed function callback ?
 // TODO 4: resources exist only within handles, redefine all interfaces
 // TODO 5: investigate possible GPU memory fragmentation when streaming in and out lots of resources
-// TODO 1: defer resource-unload on ref-count 0 to an explicit call at the end of a frame, and expose explicit unload function (nullify?)
-// TODO 3: set textures which are still loaded to default values (default_white.png, default_normal.png) "placeholder", as those do not prevent rendering (like models and shaders), and cause flickering (because textures of previous render-calls are used), but how to handle IsLoaded/IsUsable state for situations where components wait on textures, maybe set manually, or use LOAD option
+// TODO 3: use placeholders also for custom rendering paths (currently only default object and texture rendering)
 
 
 // ****************************************************************
 /* resource definitions */
+#define CORE_RESOURCE_BATCH   (32u)   // max number of resource files to read at once (sorted and merged)
+#define CORE_RESOURCE_IDLE    (0.5f)  // max time (in seconds) to sleep without work, until woken up by new load requests
+#define CORE_RESOURCE_GRACE   (2.0)   // time (in seconds) to keep unreferenced resources loaded, in case they get used again
+#define CORE_RESOURCE_SETTLE  (0.2)   // time (in seconds) to wait for further changes before reloading a resource file
+#define CORE_RESOURCE_POLL    (1.0)   // time (in seconds) between file modification checks (without native file watching)
+
 enum coreResourceUpdate : coreBool
 {
     CORE_RESOURCE_UPDATE_MANUAL = false,   // updated and managed by the developer
@@ -31,6 +36,38 @@ enum coreResourceReset : coreBool
     CORE_RESOURCE_RESET_INIT = true     // invoke start up routine
 };
 
+enum coreResourcePriority : coreUint8
+{
+    CORE_RESOURCE_PRIORITY_CRITICAL = 0u,   // required for the next frame (e.g. shaders, fonts)
+    CORE_RESOURCE_PRIORITY_VISIBLE  = 1u,   // currently used for rendering (default)
+    CORE_RESOURCE_PRIORITY_PREFETCH = 2u,   // required later (e.g. music, next area)
+    CORE_RESOURCE_PRIORITIES        = 3u
+};
+
+enum coreResourceStage : coreUint8
+{
+    CORE_RESOURCE_STAGE_READ   = 0u,   // reading the resource file
+    CORE_RESOURCE_STAGE_DECODE = 1u,   // decoding on job worker threads
+    CORE_RESOURCE_STAGE_UPLOAD = 2u,   // loading with graphics context (also reading and decoding, when not decodable)
+    CORE_RESOURCE_STAGES       = 3u
+};
+
+class coreResourceHandle;
+
+
+// ****************************************************************
+/* resource loading progress */
+struct coreResourceProgress final
+{
+    coreUint32 iQueued;       // resources waiting in the load queue
+    coreUint32 iActive;       // resources currently being read, decoded or uploaded
+    coreUint32 iDone;         // resources finished since loading started
+    coreUint64 iBytesTotal;   // size of all requested resource files
+    coreUint64 iBytesDone;    // size of all finished resource files
+    coreFloat  fProgress;     // finished part (by size, by number without resource files)
+    coreFloat  fEstimate;     // estimated remaining time in seconds (based on current throughput, -1.0 = unknown)
+};
+
 
 // ****************************************************************
 /* resource interface */
@@ -50,6 +87,16 @@ public:
     virtual coreStatus Load(coreFile* pFile) = 0;
     virtual coreStatus Unload()              = 0;
 
+    /* decode resource data ahead of loading (optional, without graphics context, may run on worker threads) */
+    virtual coreStatus Decode     (coreFile* pFile) {return CORE_OK;}
+    virtual coreBool   IsDecodable()const           {return false;}
+
+    /* get estimated memory usage of the loaded resource data (CPU and GPU) */
+    virtual coreUintW GetMemorySize()const {return 0u;}
+
+    /* check for dependency on another resource (e.g. program on shader, to load again when hot-reloaded) */
+    virtual coreBool IsDependent(const coreResourceHandle* pHandle)const {return false;}
+
     /* get object properties */
     inline const coreChar* GetPath()const {return m_sPath.c_str();}
 };
@@ -81,6 +128,22 @@ private:
     coreAtomic<coreUint16> m_iRefCount;    // simple reference-counter
     coreSpinLock           m_UpdateLock;   // spinlock to prevent concurrent resource loading
 
+    coreResourcePriority m_ePriority;      // current load priority (within the load queue)
+    coreBool             m_bQueued;        // currently waiting in the load queue
+
+    coreUintW  m_iMemorySize;              // memory usage of the loaded resource (estimated)
+    coreDouble m_dReleaseTime;             // time of the last reference release (for least-recently-used eviction)
+    coreBool   m_bReleased;                // currently waiting in the release list
+
+    coreUint8  m_iTrackState;                          // loading progress state (0 = not tracked, 1 = queued, 2 = active)
+    coreUint64 m_iTrackStart;                          // high-precision time of the load request
+    coreFloat  m_afLoadTime[CORE_RESOURCE_STAGES];     // duration of each stage of the last load (in seconds)
+    coreFloat  m_fLoadLatency;                         // duration from load request until finished (in seconds)
+
+    coreResourceHandle* m_pPlaceholder;    // resource handle served while still loading (e.g. default texture)
+    coreBool            m_bReady;          // real resource object is served (switched at frame boundaries)
+    coreBool            m_bWaiting;        // currently waiting in the placeholder list
+
 
 private:
     coreResourceHandle(coreResource* pResource, coreFile* pFile, const coreChar* pcName, const coreBool bAutomatic)noexcept;
@@ -97,28 +160,50 @@ public:
     inline       coreBool  IsLoaded      ()const {return (m_eStatus != CORE_BUSY);}
     inline       coreBool  IsLoading     ()const {return (!this->IsLoaded() && m_iRefCount);}
 
+    /* access served resource object (placeholder while still loading) */
+    inline coreResource* GetServedResource()const {return (m_pPlaceholder && !m_bReady) ? m_pPlaceholder->m_pResource  : m_pResource;}
+    inline coreBool      IsServable       ()const {return (m_pPlaceholder && !m_bReady) ? m_pPlaceholder->IsLoaded() : this->IsLoaded();}
+
+    /* set placeholder served while still loading */
+    inline void                SetPlaceholder(coreResourceHandle* pPlaceholder);
+    inline coreResourceHandle* GetPlaceholder()const {return m_pPlaceholder;}
+
     /* control the reference-counter */
-    inline void RefIncrease() {m_iRefCount.FetchAdd(1u); ASSERT(m_iRefCount)}
-    inline void RefDecrease() {ASSERT(m_iRefCount) if(!m_iRefCount.SubFetch(1u) && !Core::Config->GetBool(CORE_CONFIG_BASE_PERSISTMODE)) this->Nullify();}
+    inline void RefIncrease();
+    inline void RefDecrease();
 
     /* handle resource loading */
-    inline coreBool Update () {coreSpinLocker oLocker(&m_UpdateLock); if(!this->IsLoaded() && m_iRefCount && !m_bAutomatic) {m_eStatus = m_pResource->Load(m_pFile);                      return true;} return false;}
-    inline coreBool Reload () {coreSpinLocker oLocker(&m_UpdateLock); m_pResource->Unload(); if(this->IsLoaded())           {m_eStatus = m_pResource->Load(m_pFile);                      return true;} return false;}
-    inline coreBool Nullify() {coreSpinLocker oLocker(&m_UpdateLock); m_pResource->Unload(); if(this->IsLoaded())           {m_eStatus = (m_pFile || m_bAutomatic) ? CORE_BUSY : CORE_OK; return true;} return false;}
+    inline coreBool Update () {coreSpinLocker oLocker(&m_UpdateLock); if(!this->IsLoaded() && m_iRefCount && !m_bAutomatic) {m_eStatus = m_pResource->Load(m_pFile); this->__UpdateMemory(); return true;} return false;}
+    inline coreBool Reload () {coreSpinLocker oLocker(&m_UpdateLock); m_pResource->Unload(); if(this->IsLoaded())           {m_eStatus = m_pResource->Load(m_pFile); this->__UpdateMemory(); return true;} return false;}
+    inline coreBool Nullify();
+
+    /* change load priority (moves queued handle) */
+    inline void SetPriority(const coreResourcePriority ePriority);
 
     /* attach asynchronous callbacks */
     template <typename F> coreUint32 OnLoadedOnce(F&& nFunction)const;   // [](void) -> void
 
     /* get object properties */
-    inline const coreChar*   GetName    ()const {return m_sName.c_str();}
-    inline const coreStatus& GetStatus  ()const {return m_eStatus;}
-    inline       coreUint16  GetRefCount()const {return m_iRefCount;}
+    inline const coreChar*             GetName      ()const {return m_sName.c_str();}
+    inline const coreStatus&           GetStatus    ()const {return m_eStatus;}
+    inline       coreUint16            GetRefCount  ()const {return m_iRefCount;}
+    inline const coreResourcePriority& GetPriority  ()const {return m_ePriority;}
+    inline const coreUintW&            GetMemorySize()const {return m_iMemorySize;}
+
+    /* get load times of the last load */
+    inline const coreFloat& GetLoadTime   (const coreResourceStage eStage)const {ASSERT(eStage < CORE_RESOURCE_STAGES) return m_afLoadTime[eStage];}
+    inline const coreFloat& GetLoadLatency()const                               {return m_fLoadLatency;}
 
 
 private:
     /* handle automatic resource loading */
     inline coreBool __CanAutoUpdate() {if(m_UpdateLock.TryLock()) {if(!this->IsLoaded() && m_iRefCount && m_bAutomatic) return true; m_UpdateLock.Unlock();} return false;}
-    inline void     __AutoUpdate   () {m_eStatus = m_pResource->Load(m_pFile); m_UpdateLock.Unlock();}
+    inline coreBool __CanAutoDecode() {return (m_pFile && m_pResource->IsDecodable());}
+    inline void     __AutoUpdate   () {m_eStatus = m_pResource->Load(m_pFile); this->__UpdateMemory();}   // # update-lock still acquired
+    inline void     __AutoDecode   ();
+
+    /* track memory usage of the resource */
+    inline void __UpdateMemory();
 };
 
 
@@ -152,6 +237,13 @@ public:
     /* check for usable resource object */
     inline coreBool IsUsable()const {return (m_pHandle && m_pHandle->IsLoaded());}
 
+    /* access resource object or placeholder while still loading (only for rendering) */
+    inline T*       GetServed ()const {ASSERT(m_pHandle) return d_cast<T*>(m_pHandle->GetServedResource());}
+    inline coreBool IsServable()const {return (m_pHandle && m_pHandle->IsServable());}
+
+    /* change load priority of the resource */
+    inline void SetPriority(const coreResourcePriority ePriority)const {ASSERT(m_pHandle) m_pHandle->SetPriority(ePriority);}
+
     /* attach asynchronous callbacks */
     template <typename F> coreUint32 OnUsableOnce(F&& nFunction)const {ASSERT(m_pHandle) return m_pHandle->OnLoadedOnce(std::forward<F>(nFunction));}   // [](void) -> void
 };
@@ -175,6 +267,9 @@ private:
 
     /* reshape with the resource manager */
     virtual void __Reshape();
+
+    /* check for dependency on a resource (to reshape when hot-reloaded) */
+    virtual coreBool __IsDependent(const coreResourceHandle* pHandle)const {return false;}
 };
 
 
@@ -185,16 +280,63 @@ class coreResourceManager final : public coreThread
 private:
     coreMapStr<coreResourceHandle*> m_apHandle;                    // resource handles
 
-    coreMapStr<coreArchive*> m_apArchive;                          // archives with resource files
-    coreMapStr<coreFile*>    m_apDirectFile;                       // direct resource files
+    coreMapStr<coreArchive*>       m_apArchive;                    // archives with resource files (in mount order)
+    coreMapStr<coreFile*>          m_apDirectFile;                 // direct resource files
+    coreMap<coreUint32, coreFile*> m_apFileIndex;                  // global index over all archive files (sorted by path hash)
+    coreBool                       m_bDirectMode;                  // prefer direct resource files over the archive file index (same order in all builds)
 
     coreMap<coreResourceHandle*, coreResourceHandle*> m_apProxy;   // resource proxies pointing to foreign handles <proxy, foreign>
 
     coreSet<coreResourceRelation*> m_apRelation;                   // objects to reset with the resource manager
 
-    coreSpinLock m_ResourceLock;                                   // spinlock to prevent invalid resource handle access
-    coreSpinLock m_FileLock;                                       // spinlock to prevent invalid resource file access
-    coreBool     m_bActive;                                        // current management status
+    coreList<coreResourceHandle*> m_aapQueue[CORE_RESOURCE_PRIORITIES];      // load queues with referenced but not yet loaded resource handles
+    coreUintW                     m_aiQueueHead[CORE_RESOURCE_PRIORITIES];   // current read position per load queue
+    coreAtomic<coreUint32>        m_iQueueNum;                               // number of queue entries (for fast idle check)
+    coreSpinLock                  m_QueueLock;                               // spinlock to prevent invalid load queue access
+    coreList<coreResourceHandle*> m_apRetry;                                 // unfinished resource handles to re-add after the current update
+
+    coreList<coreResourceHandle*> m_apBatch;                                 // resource handles waiting for batched reading (# with acquired update-lock)
+    std::deque<coreResourceHandle*> m_apDecode;                              // resource handles waiting for decoding, in read order (# with acquired update-lock)
+    coreSet<coreFile*>            m_apDecodeFile;                            // resource files currently used for reading or decoding (only one resource handle per file)
+    coreAtomic<coreUint32>        m_iDecodeNum;                              // number of waiting resource handles (for fast idle check)
+    coreSpinLock                  m_DecodeLock;                              // spinlock to prevent invalid decode list access
+    coreJobCounter                m_DecodeCounter;                           // counter for all submitted decode jobs (CPU stage of resource loading)
+    coreBool                      m_bDecodeActive;                           // decode jobs are executed on job worker threads
+
+    coreList<coreResourceHandle*> m_apRelease;                               // unreferenced but still loaded resource handles (candidates for unloading)
+    coreSpinLock                  m_ReleaseLock;                             // spinlock to prevent invalid release list access
+    coreAtomic<coreUintW>         m_iMemoryUsage;                            // memory usage of all loaded resources (estimated)
+
+    coreList<coreString>          m_asRecord;                                // names of resource handles touched while recording a manifest (in first-use order)
+    coreSet<coreUint32>           m_aiRecordHash;                            // hashes of recorded names (for fast duplicate check)
+    coreAtomic<coreBool>          m_bRecording;                              // manifest recording is active
+    coreSpinLock                  m_RecordLock;                              // spinlock to prevent invalid manifest recording
+    coreList<coreResourceHandle*> m_apPrefetch;                              // resource handles referenced by prefetched manifests
+
+    coreUint32   m_iTrackQueued;                                   // number of tracked resources waiting in the load queue
+    coreUint32   m_iTrackActive;                                   // number of tracked resources currently being loaded
+    coreUint32   m_iTrackDone;                                     // number of tracked resources finished since loading started
+    coreUint64   m_iTrackBytesTotal;                               // size of all tracked resource files
+    coreUint64   m_iTrackBytesDone;                                // size of all finished resource files
+    coreUint64   m_iTrackStart;                                    // high-precision time when loading started
+    coreSpinLock m_TrackLock;                                      // spinlock to prevent invalid loading progress access
+
+    coreMap<coreUint32, coreResourceHandle*> m_apDefault;          // default placeholders for new resources <type identifier, placeholder>
+    coreList<coreResourceHandle*> m_apPlaceholder;                 // referenced placeholders (kept loaded)
+    coreList<coreResourceHandle*> m_apWaiting;                     // resource handles still serving their placeholder
+    coreAtomic<coreUint32>        m_iWaitingNum;                   // number of waiting resource handles (for fast idle check)
+    coreSpinLock                  m_PlaceholderLock;               // spinlock to prevent invalid placeholder access
+
+    coreMap<coreFile*, std::time_t> m_aiWatchTime;                 // watched direct resource files with last known write time
+    coreMap<coreFile*, coreDouble>  m_adWatchChange;               // changed resource files waiting to settle <file, time of the last change>
+    coreMap<coreInt32, coreString>  m_asWatchFolder;               // watched folders per watch descriptor
+    coreInt32                       m_iWatchHandle;                // native file watching instance (-1 = polling only)
+    coreDouble                      m_dWatchPoll;                  // time of the last file modification check
+    coreBool                        m_bWatchActive;                // hot-reloading is enabled
+
+    coreRWSpinLock m_ResourceLock;                                 // spinlock to prevent invalid resource handle access (shared for lookups)
+    coreSpinLock   m_FileLock;                                     // spinlock to prevent invalid resource file access
+    coreBool       m_bActive;                                      // current management status
 
 
 private:
@@ -204,6 +346,7 @@ private:
 
 public:
     FRIEND_CLASS(Core)
+    FRIEND_CLASS(coreResourceHandle)
     FRIEND_CLASS(coreResourceRelation)
     DISABLE_COPY(coreResourceManager)
 
@@ -212,6 +355,27 @@ public:
     inline coreBool  IsLoading   ()const {return std::any_of  (m_apHandle.begin(), m_apHandle.end(), [](const coreResourceHandle* pHandle) {return pHandle->IsLoading();});}
     inline coreUintW IsLoadingNum()const {return std::count_if(m_apHandle.begin(), m_apHandle.end(), [](const coreResourceHandle* pHandle) {return pHandle->IsLoading();});}
 
+    /* handle unreferenced resources */
+    inline void      UnloadUnused  ()      {this->__UpdateUnload(true);}   // unload immediately (e.g. after switching levels)
+    inline coreUintW GetMemoryUsage()const {return m_iMemoryUsage;}        // estimated memory usage of all loaded resources
+
+    /* track loading progress and load times */
+    coreResourceProgress GetProgress  ();
+    coreStatus           SaveLoadTimes(const coreChar* pcPath);   // export load times of all resources (slowest first)
+
+    /* set default placeholder for new resources of a type */
+    template <typename T> inline void SetPlaceholder(const coreHashString& sName) {this->__SetDefault(coreData::TypeId<T>(), sName ? this->Get<T>(sName) : NULL);}
+
+    /* record and prefetch resource manifests (all resources a scope touches, in first-use order) */
+    void       StartManifest   ();
+    coreStatus EndManifest     (const coreChar* pcPath);   // stop recording and save manifest file
+    coreStatus PrefetchManifest(const coreChar* pcPath);   // reference all listed resources (in archive order)
+    void       ReleaseManifest ();                         // release all prefetched resources
+
+    /* reload resources automatically when their resource files change */
+    void                   SetHotReload(const coreBool bEnable);
+    inline const coreBool& GetHotReload()const {return m_bWatchActive;}
+
     /* create and delete resource and resource handle */
     template <typename T, typename... A>                 coreResourceHandle* Load     (const coreHashString& sName, const coreResourceUpdate eUpdate, const coreHashString& sPath, A&&... vArgs);
     template <typename T, typename... A> RETURN_RESTRICT coreResourceHandle* LoadNew  (A&&... vArgs)const;
@@ -246,15 +410,190 @@ private:
     coreStatus __RunThread ()final;
     void       __ExitThread()final;
 
+    /* check for missing resource handles to load */
+    inline coreBool __IsThreadIdle()const final {return !m_iQueueNum;}
+
     /* load all relevant default resources */
     void __LoadDefault();
 
+    /* rebuild global archive file index */
+    void __BuildFileIndex();
+
+    /* handle decode jobs */
+    void __StartDecoding();
+    void __StopDecoding ();
+    void __LoadBatch();
+    void __DecodeResources();
+
+    /* serialize decoding of resource handles sharing the same resource file */
+    coreBool __IsFileDecoding   (coreFile* pFile);
+    void     __AcquireDecodeFile(coreFile* pFile);
+    void     __ReleaseDecodeFile(coreFile* pFile);
+
+    /* unload unreferenced resources (deferred, within memory budget) */
+    void __UpdateUnload(const coreBool bForce = false);
+    void __ReleaseHandle(coreResourceHandle* pHandle);
+
+    /* watch resource files for changes */
+    inline void __UpdateWatch() {if(m_bWatchActive) this->__ProcessWatch();}
+    void        __ProcessWatch();
+    void        __WatchFile   (coreFile* pFile);
+
+    /* handle placeholders */
+    inline void __UpdatePlaceholder() {if(m_iWaitingNum) this->__SwapPlaceholder();}
+    void        __SwapPlaceholder  ();
+    void        __BindPlaceholder  (coreResourceHandle* pPlaceholder);
+    void        __WaitPlaceholder  (coreResourceHandle* pHandle);
+
+    /* handle default placeholders per resource type */
+    void                __SetDefault(const coreUint32 iTypeId, coreResourceHandle* pPlaceholder);
+    coreResourceHandle* __GetDefault(const coreUint32 iTypeId);
+
+    /* track loading progress of resource handles */
+    void __TrackQueued  (coreResourceHandle* pHandle);
+    void __TrackActive  (coreResourceHandle* pHandle);
+    void __TrackFinished(coreResourceHandle* pHandle);
+
+    /* record resource handle into the current manifest */
+    void __RecordHandle(const coreResourceHandle* pHandle);
+
+    /* handle the load queue */
+    void                __EnqueueHandle(coreResourceHandle* pHandle, const coreBool bWake = true);
+    coreResourceHandle* __DequeueHandle();
+    void                __RemoveHandle (const coreResourceHandle* pHandle);
+
     /* bind and unbind relation-objects */
     inline void __BindRelation  (coreResourceRelation* pRelation) {ASSERT(!m_apRelation.count_bs(pRelation)) m_apRelation.insert_bs(pRelation);}
     inline void __UnbindRelation(coreResourceRelation* pRelation) {ASSERT( m_apRelation.count_bs(pRelation)) m_apRelation.erase_bs (pRelation);}
+
 };
 
 
+// ****************************************************************
+/* increase the reference-counter */
+inline void coreResourceHandle::RefIncrease()
+{
+    // request loading on first reference
+    if(!m_iRefCount.FetchAdd(1u) && m_bAutomatic && !this->IsLoaded()) Core::Manager::Resource->__EnqueueHandle(this);
+    ASSERT(m_iRefCount)
+
+    // track usage for the current manifest
+    if(Core::Manager::Resource->m_bRecording) Core::Manager::Resource->__RecordHandle(this);
+}
+
+
+// ****************************************************************
+/* decrease the reference-counter */
+inline void coreResourceHandle::RefDecrease()
+{
+    ASSERT(m_iRefCount)
+
+    // defer unloading to the end of the frame
+    if(!m_iRefCount.SubFetch(1u) && !Core::Config->GetBool(CORE_CONFIG_BASE_PERSISTMODE)) Core::Manager::Resource->__ReleaseHandle(this);
+}
+
+
+// ****************************************************************
+/* set placeholder served while still loading */
+inline void coreResourceHandle::SetPlaceholder(coreResourceHandle* pPlaceholder)
+{
+    ASSERT(pPlaceholder != this)
+
+    m_pPlaceholder = pPlaceholder;
+    if(m_pPlaceholder)
+    {
+        // keep placeholder loaded (served while loading, after being requested)
+        Core::Manager::Resource->__BindPlaceholder(m_pPlaceholder);
+
+        // serve placeholder immediately when already requested
+        m_bReady = this->IsLoaded();
+        if(this->IsLoading() && m_bAutomatic) Core::Manager::Resource->__WaitPlaceholder(this);
+    }
+}
+
+
+// ****************************************************************
+/* unload resource object */
+inline coreBool coreResourceHandle::Nullify()
+{
+    coreSpinLocker oLocker(&m_UpdateLock);
+
+    m_pResource->Unload();
+    this->__UpdateMemory();
+
+    if(this->IsLoaded())
+    {
+        m_eStatus = (m_pFile || m_bAutomatic) ? CORE_BUSY : CORE_OK;
+
+        // request loading again while still referenced (serves placeholder again until reloaded)
+        if(m_iRefCount && m_bAutomatic) Core::Manager::Resource->__EnqueueHandle(this);
+        return true;
+    }
+    return false;
+}
+
+
+// ****************************************************************
+/* decode resource data on a worker thread */
+inline void coreResourceHandle::__AutoDecode()
+{
+    ASSERT(m_UpdateLock.IsLocked())
+
+    // decode resource data (and measure duration)
+    const coreUint64 iStart  = SDL_GetPerformanceCounter();
+    const coreStatus eDecode = m_pResource->Decode(m_pFile);
+    m_afLoadTime[CORE_RESOURCE_STAGE_DECODE] += coreFloat(coreDouble(SDL_GetPerformanceCounter() - iStart) * Core::System->GetPerfFrequency());
+
+    // allow other resource handles to use the resource file again (# before requesting loading again)
+    Core::Manager::Resource->__ReleaseDecodeFile(m_pFile);
+
+    // finish immediately on error, or request loading again (# before releasing the lock)
+    if(eDecode < CORE_OK) m_eStatus = eDecode;
+    else if(m_iRefCount) Core::Manager::Resource->__EnqueueHandle(this);
+
+    // stop tracking when finished (failed or not referenced anymore)
+    if((eDecode < CORE_OK) || !m_iRefCount) Core::Manager::Resource->__TrackFinished(this);
+
+    m_UpdateLock.Unlock();
+}
+
+
+// ****************************************************************
+/* track memory usage of the resource */
+inline void coreResourceHandle::__UpdateMemory()
+{
+    ASSERT(m_UpdateLock.IsLocked())
+
+    // ignore resource proxies (without own resource)
+    if(!m_pFile && !m_bAutomatic) return;
+
+    // apply difference to the total memory usage (# wraps around on decrease)
+    const coreUintW iNewSize = m_pResource->GetMemorySize();
+    Core::Manager::Resource->m_iMemoryUsage.FetchAdd(iNewSize - m_iMemorySize);
+    m_iMemorySize = iNewSize;
+}
+
+
+// ****************************************************************
+/* change load priority */
+inline void coreResourceHandle::SetPriority(const coreResourcePriority ePriority)
+{
+    ASSERT(ePriority < CORE_RESOURCE_PRIORITIES)
+
+    if(m_ePriority == ePriority) return;
+
+    coreSpinLocker oLocker(&Core::Manager::Resource->m_QueueLock);
+
+    // move into the new load queue (old entry will be skipped)
+    m_ePriority = ePriority;
+    if(m_bQueued)
+    {
+        Core::Manager::Resource->m_aapQueue[ePriority].push_back(this);
+        Core::Manager::Resource->m_iQueueNum.FetchAdd(1u);
+    }
+}
+
+
 // ****************************************************************
 /* attach asynchronous callbacks */
 template <typename F> coreUint32 coreResourceHandle::OnLoadedOnce(F&& nFunction)const
@@ -342,6 +681,13 @@ template <typename T, typename... A> coreResourceHandle* coreResourceManager::Lo
     // create new resource handle
     coreResourceHandle* pNewHandle = MANAGED_NEW(coreResourceHandle, new T(std::forward<A>(vArgs)...), sPath ? this->RetrieveFile(sPath) : NULL, sName.GetString(), eUpdate ? true : false);
 
+    // assign default placeholder of the resource type
+    if(sPath && eUpdate)
+    {
+        coreResourceHandle* pPlaceholder = this->__GetDefault(coreData::TypeId<T>());
+        if(pPlaceholder) pNewHandle->SetPlaceholder(pPlaceholder);
+    }
+
     m_ResourceLock.Lock();
     {
         // add resource handle to manager
@@ -399,18 +745,52 @@ template <typename T> void coreResourceManager::Free(coreResourcePtr<T>* OUTPUT
                     break;
                 }
             }
+
         }
         m_ResourceLock.Unlock();
 
         // delete possible resource proxy
         m_apProxy.erase(pHandle);
 
-        // wait on possible resource loading
+        // wait on possible resource loading or decoding
         pHandle->m_UpdateLock.Lock();
+        {
+            m_ResourceLock.Lock();
+            {
+                // remove resource handle from load queue (# after decoding, which may add it again)
+                this->__RemoveHandle(pHandle);
+
+                // drop prefetch references (handle is deleted anyway)
+                std::erase(m_apPrefetch, pHandle);
+
+                // stop tracking loading progress
+                this->__TrackFinished(pHandle);
+
+                // stop serving placeholder
+                coreSpinLocker oLocker(&m_PlaceholderLock);
+                if(pHandle->m_bWaiting)
+                {
+                    std::erase(m_apWaiting, pHandle);
+                    m_iWaitingNum = m_apWaiting.size();
+                }
+                ASSERT(!std::count(m_apPlaceholder.begin(), m_apPlaceholder.end(), pHandle))
+            }
+            m_ResourceLock.Unlock();
+        }
         pHandle->m_UpdateLock.Unlock();   // # locked again in destructor
 
-        // delete resource handle
+        // remove reference
         (*pptResourcePtr) = NULL;
+
+        m_ReleaseLock.Lock();
+        {
+            // remove resource handle from release list (# after removing the reference)
+            if(pHandle->m_bReleased) std::erase(m_apRelease, pHandle);
+        }
+        m_ReleaseLock.Unlock();
+
+        // delete resource handle
+        m_iMemoryUsage.FetchSub(pHandle->m_iMemorySize);
         MANAGED_DELETE(pHandle)
     }
 }
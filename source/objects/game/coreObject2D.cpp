@@ -144,11 +144,11 @@ coreBool coreObject2D::Prepare(const coreProgramPtr& pProgram)
 
     // enable the shader-program
     ASSERT(pProgram)
-    if(!pProgram.IsUsable()) return false;
-    if(!pProgram->Enable())  return false;
+    if(!pProgram.IsServable())          return false;
+    if(!pProgram.GetServed()->Enable()) return false;
 
     // update all object uniforms
-    coreProgram* pLocal = pProgram.GetResource();
+    coreProgram* pLocal = pProgram.GetServed();
     pLocal->SendUniform(CORE_SHADER_UNIFORM_2D_SCREENVIEW, coreMatrix3(m_mTransform) * Core::Graphics->GetOrtho().m124(), false);
     pLocal->SendUniform(CORE_SHADER_UNIFORM_COLOR,         m_vColor);
     pLocal->SendUniform(CORE_SHADER_UNIFORM_TEXPARAM,      coreVector4(m_vTexSize, m_vTexOffset));
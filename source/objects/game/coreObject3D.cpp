@@ -136,17 +136,17 @@ coreBool coreObject3D::Prepare(const coreProgramPtr& pProgram)
 {
     if(!this->IsEnabled(CORE_OBJECT_ENABLE_RENDER)) return false;
 
-    // check for model status
+    // check for model status (or placeholder)
     ASSERT(m_pModel)
-    if(!m_pModel.IsUsable()) return false;
+    if(!m_pModel.IsServable()) return false;
 
     // enable the shader-program
     ASSERT(pProgram)
-    if(!pProgram.IsUsable()) return false;
-    if(!pProgram->Enable())  return false;
+    if(!pProgram.IsServable())          return false;
+    if(!pProgram.GetServed()->Enable()) return false;
 
     // update all object uniforms
-    coreProgram* pLocal = pProgram.GetResource();
+    coreProgram* pLocal = pProgram.GetServed();
     pLocal->SendUniform(CORE_SHADER_UNIFORM_3D_POSITION, m_vPosition);
     pLocal->SendUniform(CORE_SHADER_UNIFORM_3D_SIZE,     m_vSize);
     pLocal->SendUniform(CORE_SHADER_UNIFORM_3D_ROTATION, m_vRotation);
@@ -157,7 +157,7 @@ coreBool coreObject3D::Prepare(const coreProgramPtr& pProgram)
     coreTexture::EnableAll(m_apTexture);
 
     // enable the model
-    m_pModel->Enable();
+    m_pModel.GetServed()->Enable();
     return true;
 }
 
@@ -176,7 +176,7 @@ void coreObject3D::Render(const coreProgramPtr& pProgram)
     if(this->Prepare(pProgram))
     {
         // draw the model
-        m_pModel->Draw();
+        m_pModel.GetServed()->Draw();
     }
 }
 
@@ -546,19 +546,20 @@ void coreBatchList::__RenderDefault(const coreProgramPtr& pProgramInstanced, con
         const coreObject3D* pFirst = m_apObjectList.front();
         const coreModelPtr& pModel = pFirst->GetModel();
 
-        // check for model status
+        // check for model status (or placeholder)
         ASSERT(pModel)
-        if(!pModel.IsUsable()) return;
+        if(!pModel.IsServable()) return;
+        coreModel* pLocalModel = pModel.GetServed();
 
         // detect model changes and invoke update
-        const GLuint iIdentifier = pModel->GetVertexBuffer(0u)->GetIdentifier();
+        const GLuint iIdentifier = pLocalModel->GetVertexBuffer(0u)->GetIdentifier();
         if(m_iLastModel != iIdentifier) m_iFilled = 0u;
         m_iLastModel = iIdentifier;
 
         // enable the shader-program
         ASSERT(pProgramInstanced)
-        if(!pProgramInstanced.IsUsable()) return;
-        if(!pProgramInstanced->Enable())  return;
+        if(!pProgramInstanced.IsServable())          return;
+        if(!pProgramInstanced.GetServed()->Enable()) return;
 
         // enable all active textures
         coreTexture::EnableAll(&pFirst->GetTexture(0u));
@@ -574,31 +575,49 @@ void coreBatchList::__RenderDefault(const coreProgramPtr& pProgramInstanced, con
             m_aInstanceBuffer.next();
 
             // map required area of the instance data buffer
-            coreByte* pRange  = m_aInstanceBuffer.current().Map(0u, iRenderCount * CORE_BATCHLIST_INSTANCE_SIZE, CORE_DATABUFFER_MAP_INVALIDATE_ALL);
-            coreByte* pCursor = pRange;
+            coreByte* pRange = m_aInstanceBuffer.current().Map(0u, iRenderCount * CORE_BATCHLIST_INSTANCE_SIZE, CORE_DATABUFFER_MAP_INVALIDATE_ALL);
 
-            FOR_EACH(it, m_apObjectList)
+            // prepare function for writing instance data
+            const auto nWriteFunc = [](const coreObject3D* pObject, coreByte* OUTPUT pCursor)
             {
-                const coreObject3D* pObject = (*it);
-
-                // render only enabled objects
-                if(pObject->IsEnabled(CORE_OBJECT_ENABLE_RENDER))
+                // compress data
+                const coreUint64 iSize      = coreVector4(pObject->GetSize(), 0.0f)                      .PackFloat4x16();
+                const coreUint64 iRotation  = pObject->GetRotation()                                     .PackSnorm4x16();
+                const coreUint32 iColor     = pObject->GetColor4  ()                                     .PackUnorm4x8 ();
+                const coreUint64 iTexParams = coreVector4(pObject->GetTexSize(), pObject->GetTexOffset()).PackFloat4x16();
+                ASSERT((pObject->GetColor4   ().Min() >=  0.0f) && (pObject->GetColor4   ().Max() <= 1.0f))
+                ASSERT((pObject->GetTexOffset().Min() >= -4.0f) && (pObject->GetTexOffset().Max() <= 4.0f))
+
+                // write data to the buffer
+                std::memcpy(pCursor,       &pObject->GetPosition(), sizeof(coreVector3));
+                std::memcpy(pCursor + 12u, &iSize,                  sizeof(coreUint64));
+                std::memcpy(pCursor + 20u, &iRotation,              sizeof(coreUint64));
+                std::memcpy(pCursor + 28u, &iColor,                 sizeof(coreUint32));
+                std::memcpy(pCursor + 32u, &iTexParams,             sizeof(coreUint64));
+            };
+
+            if(iRenderCount == m_apObjectList.size())
+            {
+                // write all objects in parallel (each with fixed buffer location)
+                Core::Manager::Job->ParallelFor(iRenderCount, CORE_BATCHLIST_INSTANCE_GRAIN, [&](const coreUintW i)
                 {
-                    // compress data
-                    const coreUint64 iSize      = coreVector4(pObject->GetSize(), 0.0f)                      .PackFloat4x16();
-                    const coreUint64 iRotation  = pObject->GetRotation()                                     .PackSnorm4x16();
-                    const coreUint32 iColor     = pObject->GetColor4  ()                                     .PackUnorm4x8 ();
-                    const coreUint64 iTexParams = coreVector4(pObject->GetTexSize(), pObject->GetTexOffset()).PackFloat4x16();
-                    ASSERT((pObject->GetColor4   ().Min() >=  0.0f) && (pObject->GetColor4   ().Max() <= 1.0f))
-                    ASSERT((pObject->GetTexOffset().Min() >= -4.0f) && (pObject->GetTexOffset().Max() <= 4.0f))
+                    nWriteFunc(m_apObjectList[i], pRange + i * CORE_BATCHLIST_INSTANCE_SIZE);
+                });
+            }
+            else
+            {
+                coreByte* pCursor = pRange;
 
-                    // write data to the buffer
-                    std::memcpy(pCursor,       &pObject->GetPosition(), sizeof(coreVector3));
-                    std::memcpy(pCursor + 12u, &iSize,                  sizeof(coreUint64));
-                    std::memcpy(pCursor + 20u, &iRotation,              sizeof(coreUint64));
-                    std::memcpy(pCursor + 28u, &iColor,                 sizeof(coreUint32));
-                    std::memcpy(pCursor + 32u, &iTexParams,             sizeof(coreUint64));
-                    pCursor += CORE_BATCHLIST_INSTANCE_SIZE;
+                FOR_EACH(it, m_apObjectList)
+                {
+                    const coreObject3D* pObject = (*it);
+
+                    // render only enabled objects
+                    if(pObject->IsEnabled(CORE_OBJECT_ENABLE_RENDER))
+                    {
+                        nWriteFunc(pObject, pCursor);
+                        pCursor += CORE_BATCHLIST_INSTANCE_SIZE;
+                    }
                 }
             }
 
@@ -622,19 +641,19 @@ void coreBatchList::__RenderDefault(const coreProgramPtr& pProgramInstanced, con
             STATIC_ASSERT(sizeof(m_iFilled)*8u >= CORE_BATCHLIST_INSTANCE_BUFFERS)
 
             // set vertex data (model only)
-            for(coreUintW i = 0u, ie = pModel->GetNumVertexBuffers(); i < ie; ++i)
-                pModel->GetVertexBuffer(i)->Activate(0u);
+            for(coreUintW i = 0u, ie = pLocalModel->GetNumVertexBuffers(); i < ie; ++i)
+                pLocalModel->GetVertexBuffer(i)->Activate(0u);
 
             // set index data
-            if(pModel->GetIndexBuffer()->IsValid())
+            if(pLocalModel->GetIndexBuffer()->IsValid())
             {
                 coreDataBuffer::Unbind(GL_ELEMENT_ARRAY_BUFFER, false);
-                pModel->GetIndexBuffer()->Bind();
+                pLocalModel->GetIndexBuffer()->Bind();
             }
         }
 
         // draw the model instanced
-        pModel->DrawInstanced(iRenderCount);
+        pLocalModel->DrawInstanced(iRenderCount);
     }
     else
     {
@@ -21,6 +21,7 @@
 #define CORE_BATCHLIST_INSTANCE_SIZE      (40u)   // instancing per-object size (position (12), size (8), rotation (8), color (4), texture-parameters (8))
 #define CORE_BATCHLIST_INSTANCE_BUFFERS   (3u)    // number of concurrent instance data buffer
 #define CORE_BATCHLIST_INSTANCE_THRESHOLD (4u)    // minimum number of objects to draw instanced
+#define CORE_BATCHLIST_INSTANCE_GRAIN     (256u)  // minimum number of objects per job when writing instance data in parallel
 
 enum coreBatchListUpdate : coreUint8
 {
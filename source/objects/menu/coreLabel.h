@@ -97,6 +97,9 @@ private:
     /* reshape with the resource manager */
     void __Reshape()final;
 
+    /* check for dependency on the font (to regenerate when hot-reloaded) */
+    inline coreBool __IsDependent(const coreResourceHandle* pHandle)const final {return (m_pFont.GetHandle() == pHandle);}
+
     /* update object after modification */
     inline void __Update()final {ADD_FLAG(m_eRefresh, CORE_LABEL_REFRESH_ALL)}
 
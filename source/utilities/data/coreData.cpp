@@ -8,6 +8,7 @@
 ///////////////////////////////////////////////////////////
 #include "Core.h"
 #include <stb_sprintf.h>
+#include <zstd/zdict.h>
 
 #if defined(_CORE_WINDOWS_)
     #include <Psapi.h>
@@ -31,9 +32,14 @@
     #include <sys/utsname.h>
     #include <sys/statvfs.h>
     #include <sys/stat.h>
+    #include <sys/mman.h>
+    #include <fcntl.h>
 #endif
 
-thread_local coreData::coreTempString coreData::s_TempString     = {};
+thread_local coreData::coreTempString  coreData::s_TempString     = {};
+thread_local coreData::coreZstdContext coreData::s_ZstdContext    = {};
+coreSet<coreData::coreZstdContext*>    coreData::s_apZstdContext  = {};
+coreSpinLock                           coreData::s_ZstdLock;
 coreMapStrFull<const coreChar*>       coreData::s_apcCommandLine = {};
 coreString                            coreData::s_sUserFolder    = "";
 
@@ -1191,6 +1197,89 @@ std::time_t coreData::FileWriteTime(const coreChar* pcPath)
 }
 
 
+// ****************************************************************
+/* map file into memory (read-only) */
+void* coreData::FileMap(const coreChar* pcPath, coreUint64* OUTPUT piSize)
+{
+    ASSERT(pcPath && piSize)
+
+    // reset output size
+    (*piSize) = 0u;
+
+#if defined(_CORE_WINDOWS_)
+
+    // open file
+    const HANDLE pFile = CreateFileW(coreData::__ToWideChar(pcPath), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(pFile == INVALID_HANDLE_VALUE) return NULL;
+
+    void* pPointer = NULL;
+
+    // get file size
+    LARGE_INTEGER oSize;
+    if(GetFileSizeEx(pFile, &oSize) && (oSize.QuadPart > 0))
+    {
+        // create file mapping
+        const HANDLE pMapping = CreateFileMappingW(pFile, NULL, PAGE_READONLY, 0u, 0u, NULL);
+        if(pMapping)
+        {
+            // map whole file (view stays valid after closing the handles)
+            pPointer = MapViewOfFile(pMapping, FILE_MAP_READ, 0u, 0u, 0u);
+            if(pPointer) (*piSize) = oSize.QuadPart;
+
+            CloseHandle(pMapping);
+        }
+    }
+
+    CloseHandle(pFile);
+    return pPointer;
+
+#elif defined(_CORE_LINUX_) || defined(_CORE_MACOS_)
+
+    // open file
+    const coreInt32 iFile = open(pcPath, O_RDONLY | O_CLOEXEC);
+    if(iFile < 0) return NULL;
+
+    void* pPointer = NULL;
+
+    // get file size
+    struct stat oBuffer;
+    if(!fstat(iFile, &oBuffer) && (oBuffer.st_size > 0))
+    {
+        // map whole file (mapping stays valid after closing the descriptor)
+        pPointer = mmap(NULL, oBuffer.st_size, PROT_READ, MAP_PRIVATE, iFile, 0);
+        if(pPointer == MAP_FAILED) pPointer = NULL;
+                              else (*piSize) = oBuffer.st_size;
+    }
+
+    close(iFile);
+    return pPointer;
+
+#else
+
+    return NULL;
+
+#endif
+}
+
+
+// ****************************************************************
+/* unmap file from memory */
+void coreData::FileUnmap(void* pPointer, const coreUint64 iSize)
+{
+    ASSERT(pPointer && iSize)
+
+#if defined(_CORE_WINDOWS_)
+
+    WARN_IF(!UnmapViewOfFile(pPointer)) {}
+
+#elif defined(_CORE_LINUX_) || defined(_CORE_MACOS_)
+
+    WARN_IF(munmap(pPointer, iSize)) {}
+
+#endif
+}
+
+
 // ****************************************************************
 /* copy file from source to destination (and replace) */
 coreStatus coreData::FileCopy(const coreChar* pcFrom, const coreChar* pcTo)
@@ -1610,8 +1699,9 @@ coreStatus coreData::Compress(const coreByte* pInput, const coreUint32 iInputSiz
     const coreUintW iBound  = ZSTD_compressBound(iInputSize);
     coreByte*       pBuffer = new coreByte[iBound + sizeof(coreUint32)];
 
-    // compress data
-    const coreUintW iWritten = ZSTD_compress(pBuffer + sizeof(coreUint32), iBound, pInput, iInputSize, iLevel);
+    // compress data (lock cached context against purging)
+    coreSpinLocker oLocker(&s_ZstdContext.Lock);
+    const coreUintW iWritten = ZSTD_compressCCtx(coreData::__GetCompressContext(), pBuffer + sizeof(coreUint32), iBound, pInput, iInputSize, iLevel);
     if(ZSTD_isError(iWritten))
     {
         Core::Log->Warning("Error compressing data (ZSTD: %s)", ZSTD_getErrorName(iWritten));
@@ -1646,8 +1736,9 @@ coreStatus coreData::Decompress(const coreByte* pInput, const coreUint32 iInputS
     const coreUint32 iBound  = (*r_cast<const coreUint32*>(pInput));
     coreByte*        pBuffer = new coreByte[iBound];
 
-    // decompress data
-    const coreUintW iWritten = ZSTD_decompress(pBuffer, iBound, pInput + sizeof(coreUint32), iInputSize - sizeof(coreUint32));
+    // decompress data (lock cached context against purging)
+    coreSpinLocker oLocker(&s_ZstdContext.Lock);
+    const coreUintW iWritten = ZSTD_decompressDCtx(coreData::__GetDecompressContext(), pBuffer, iBound, pInput + sizeof(coreUint32), iInputSize - sizeof(coreUint32));
     if(ZSTD_isError(iWritten))
     {
         Core::Log->Warning("Error decompressing data (ZSTD: %s)", ZSTD_getErrorName(iWritten));
@@ -1665,6 +1756,79 @@ coreStatus coreData::Decompress(const coreByte* pInput, const coreUint32 iInputS
 }
 
 
+// ****************************************************************
+/* compress data with Zstandard library and pre-digested dictionary */
+coreStatus coreData::Compress(const coreByte* pInput, const coreUint32 iInputSize, coreByte** OUTPUT ppOutput, coreUint32* OUTPUT piOutputSize, const ZSTD_CDict* pDict)
+{
+#if defined(_CORE_EMSCRIPTEN_)
+
+    return CORE_ERROR_SUPPORT;
+
+#else
+
+    ASSERT(pInput && iInputSize && ppOutput && piOutputSize && pDict)
+
+    // retrieve required output size
+    const coreUintW iBound  = ZSTD_compressBound(iInputSize);
+    coreByte*       pBuffer = new coreByte[iBound + sizeof(coreUint32)];
+
+    // compress data (lock cached context against purging)
+    coreSpinLocker oLocker(&s_ZstdContext.Lock);
+    const coreUintW iWritten = ZSTD_compress_usingCDict(coreData::__GetCompressContext(), pBuffer + sizeof(coreUint32), iBound, pInput, iInputSize, pDict);
+    if(ZSTD_isError(iWritten))
+    {
+        Core::Log->Warning("Error compressing data with dictionary (ZSTD: %s)", ZSTD_getErrorName(iWritten));
+        SAFE_DELETE_ARRAY(pBuffer)
+        return CORE_INVALID_INPUT;
+    }
+
+    // store original size and return compressed data
+    (*r_cast<coreUint32*>(pBuffer)) = iInputSize;
+    (*ppOutput)     = pBuffer;
+    (*piOutputSize) = iWritten + sizeof(coreUint32);
+
+    return CORE_OK;
+
+#endif
+}
+
+
+// ****************************************************************
+/* decompress data with Zstandard library and pre-digested dictionary */
+coreStatus coreData::Decompress(const coreByte* pInput, const coreUint32 iInputSize, coreByte** OUTPUT ppOutput, coreUint32* OUTPUT piOutputSize, const ZSTD_DDict* pDict)
+{
+#if defined(_CORE_EMSCRIPTEN_)
+
+    return CORE_ERROR_SUPPORT;
+
+#else
+
+    ASSERT(pInput && iInputSize && ppOutput && piOutputSize && pDict)
+
+    // retrieve original size
+    const coreUint32 iBound  = (*r_cast<const coreUint32*>(pInput));
+    coreByte*        pBuffer = new coreByte[iBound];
+
+    // decompress data (lock cached context against purging)
+    coreSpinLocker oLocker(&s_ZstdContext.Lock);
+    const coreUintW iWritten = ZSTD_decompress_usingDDict(coreData::__GetDecompressContext(), pBuffer, iBound, pInput + sizeof(coreUint32), iInputSize - sizeof(coreUint32), pDict);
+    if(ZSTD_isError(iWritten))
+    {
+        Core::Log->Warning("Error decompressing data with dictionary (ZSTD: %s)", ZSTD_getErrorName(iWritten));
+        SAFE_DELETE_ARRAY(pBuffer)
+        return CORE_INVALID_INPUT;
+    }
+
+    // return decompressed data
+    (*ppOutput)     = pBuffer;
+    (*piOutputSize) = iBound;
+
+    return CORE_OK;
+
+#endif
+}
+
+
 // ****************************************************************
 /* scramble data with 32-bit key */
 void coreData::Scramble(coreByte* OUTPUT pData, const coreUintW iSize, const coreUint64 iKey)
@@ -1688,6 +1852,131 @@ void coreData::Unscramble(coreByte* OUTPUT pData, const coreUintW iSize, const c
 }
 
 
+// ****************************************************************
+/* purge cached compression contexts of all threads */
+void coreData::PurgeContexts()
+{
+    coreSpinLocker oLocker(&s_ZstdLock);
+
+    FOR_EACH(it, s_apZstdContext)
+    {
+        coreZstdContext* pContext = (*it);
+
+        // skip contexts currently in use (purged with the next call)
+        if(!pContext->Lock.TryLock()) continue;
+        {
+        #if !defined(_CORE_EMSCRIPTEN_)
+
+            // free all context memory (will be re-created on next use)
+            ZSTD_freeCCtx(pContext->pCompress);
+            ZSTD_freeDCtx(pContext->pDecompress);
+
+        #endif
+
+            pContext->pCompress   = NULL;
+            pContext->pDecompress = NULL;
+        }
+        pContext->Lock.Unlock();
+    }
+}
+
+
+// ****************************************************************
+/* train compression dictionary from many small samples */
+coreStatus coreData::DictTrain(const coreByte* pSamples, const coreUintW* piSampleSize, const coreUint32 iNumSamples, const coreUint32 iMaxSize, coreByte** OUTPUT ppOutput, coreUint32* OUTPUT piOutputSize)
+{
+#if defined(_CORE_EMSCRIPTEN_)
+
+    return CORE_ERROR_SUPPORT;
+
+#else
+
+    ASSERT(pSamples && piSampleSize && iNumSamples && iMaxSize && ppOutput && piOutputSize)
+
+    coreByte* pBuffer = new coreByte[iMaxSize];
+
+    // train dictionary (requires a reasonable amount of samples)
+    const coreUintW iWritten = ZDICT_trainFromBuffer(pBuffer, iMaxSize, pSamples, piSampleSize, iNumSamples);
+    if(ZDICT_isError(iWritten))
+    {
+        Core::Log->Warning("Error training dictionary (ZDICT: %s)", ZDICT_getErrorName(iWritten));
+        SAFE_DELETE_ARRAY(pBuffer)
+        return CORE_INVALID_INPUT;
+    }
+
+    // return dictionary data
+    (*ppOutput)     = pBuffer;
+    (*piOutputSize) = iWritten;
+
+    return CORE_OK;
+
+#endif
+}
+
+
+// ****************************************************************
+/* create pre-digested dictionary for compression */
+ZSTD_CDict* coreData::DictCreateCompress(const coreByte* pData, const coreUint32 iSize, const coreInt32 iLevel)
+{
+#if defined(_CORE_EMSCRIPTEN_)
+
+    return NULL;
+
+#else
+
+    ASSERT(pData && iSize)
+    return ZSTD_createCDict(pData, iSize, iLevel);
+
+#endif
+}
+
+
+// ****************************************************************
+/* create pre-digested dictionary for decompression */
+ZSTD_DDict* coreData::DictCreateDecompress(const coreByte* pData, const coreUint32 iSize)
+{
+#if defined(_CORE_EMSCRIPTEN_)
+
+    return NULL;
+
+#else
+
+    ASSERT(pData && iSize)
+    return ZSTD_createDDict(pData, iSize);
+
+#endif
+}
+
+
+// ****************************************************************
+/* delete pre-digested dictionary */
+void coreData::DictDelete(ZSTD_CDict** OUTPUT ppDict)
+{
+    ASSERT(ppDict)
+
+#if !defined(_CORE_EMSCRIPTEN_)
+
+    ZSTD_freeCDict(*ppDict);
+
+#endif
+
+    (*ppDict) = NULL;
+}
+
+void coreData::DictDelete(ZSTD_DDict** OUTPUT ppDict)
+{
+    ASSERT(ppDict)
+
+#if !defined(_CORE_EMSCRIPTEN_)
+
+    ZSTD_freeDDict(*ppDict);
+
+#endif
+
+    (*ppDict) = NULL;
+}
+
+
 // ****************************************************************
 /* safely get first characters of a string */
 const coreChar* coreData::StrLeft(const coreChar* pcInput, const coreUintW iNum)
@@ -1865,4 +2154,75 @@ const coreChar* coreData::__ToAnsiChar(const coreWchar* pcText)
 #endif
 
     return NULL;
-}
\ No newline at end of file
+}
+
+
+// ****************************************************************
+/* access cached compression context */
+ZSTD_CCtx* coreData::__GetCompressContext()
+{
+#if defined(_CORE_EMSCRIPTEN_)
+
+    return NULL;
+
+#else
+
+    // create context on first use (per thread)
+    if(!s_ZstdContext.pCompress) s_ZstdContext.pCompress = ZSTD_createCCtx();
+    ASSERT(s_ZstdContext.pCompress)
+
+    return s_ZstdContext.pCompress;
+
+#endif
+}
+
+
+// ****************************************************************
+/* access cached decompression context */
+ZSTD_DCtx* coreData::__GetDecompressContext()
+{
+#if defined(_CORE_EMSCRIPTEN_)
+
+    return NULL;
+
+#else
+
+    // create context on first use (per thread)
+    if(!s_ZstdContext.pDecompress) s_ZstdContext.pDecompress = ZSTD_createDCtx();
+    ASSERT(s_ZstdContext.pDecompress)
+
+    return s_ZstdContext.pDecompress;
+
+#endif
+}
+
+
+// ****************************************************************
+/* constructor */
+coreData::coreZstdContext::coreZstdContext()noexcept
+{
+    // register for purging (on first use per thread)
+    coreSpinLocker oLocker(&s_ZstdLock);
+    s_apZstdContext.insert_bs(this);
+}
+
+
+// ****************************************************************
+/* destructor */
+coreData::coreZstdContext::~coreZstdContext()
+{
+    // unregister before freeing
+    s_ZstdLock.Lock();
+    {
+        s_apZstdContext.erase_bs(this);
+    }
+    s_ZstdLock.Unlock();
+
+#if !defined(_CORE_EMSCRIPTEN_)
+
+    // free contexts on thread exit
+    ZSTD_freeCCtx(pCompress);
+    ZSTD_freeDCtx(pDecompress);
+
+#endif
+}
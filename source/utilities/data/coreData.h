@@ -11,7 +11,6 @@
 #define _CORE_GUARD_DATA_H_
 
 // TODO 3: implement constexpr strright
-// TODO 3: reuse context on compression and decompression (ZSTD_createCCtx & co), but needs to be thread-safe ?
 // TODO 3: --help, --version, --force-32, --force-64 (windows, launcher?), --headless
 // TODO 3: add ToChars float precision parameter (+ search for 'PRINT("%f' and 'PRINT("%.')
 // TODO 3: make !temp and !appdata replace instead
@@ -65,9 +64,23 @@ private:
         coreUintW iCurrent;                                              // current temp-string
     };
 
+    /* compression-context structure */
+    struct coreZstdContext final
+    {
+        ZSTD_CCtx*   pCompress   = NULL;   // cached compression context
+        ZSTD_DCtx*   pDecompress = NULL;   // cached decompression context
+        coreSpinLock Lock;                 // spinlock held while the contexts are in use (to allow purging from other threads)
+
+        coreZstdContext()noexcept;
+        ~coreZstdContext();
+    };
+
 
 private:
-    static thread_local coreTempString s_TempString;           // thread-local temp-string container
+    static thread_local coreTempString  s_TempString;          // thread-local temp-string container
+    static thread_local coreZstdContext s_ZstdContext;         // thread-local compression contexts (reused by all compression functions)
+    static coreSet<coreZstdContext*>    s_apZstdContext;       // compression contexts of all threads (registered for purging)
+    static coreSpinLock                 s_ZstdLock;            // spinlock to prevent invalid context list access
 
     static coreMapStrFull<const coreChar*> s_apcCommandLine;   // parsed command line arguments
     static coreString                      s_sUserFolder;      // selected user folder
@@ -144,6 +157,8 @@ public:
     static coreBool    FileExists    (const coreChar* pcPath);
     static coreInt64   FileSize      (const coreChar* pcPath);
     static std::time_t FileWriteTime (const coreChar* pcPath);
+    static void*       FileMap       (const coreChar* pcPath, coreUint64* OUTPUT piSize);
+    static void        FileUnmap     (void* pPointer, const coreUint64 iSize);
     static coreStatus  FileCopy      (const coreChar* pcFrom, const coreChar* pcTo);
     static coreStatus  FileMove      (const coreChar* pcFrom, const coreChar* pcTo);
     static coreStatus  FileDelete    (const coreChar* pcPath);
@@ -166,8 +181,18 @@ public:
     /* compress and decompress data */
     static coreStatus Compress  (const coreByte* pInput, const coreUint32 iInputSize, coreByte** OUTPUT ppOutput, coreUint32* OUTPUT piOutputSize, const coreInt32 iLevel = ZSTD_CLEVEL_DEFAULT);
     static coreStatus Decompress(const coreByte* pInput, const coreUint32 iInputSize, coreByte** OUTPUT ppOutput, coreUint32* OUTPUT piOutputSize);
+    static coreStatus Compress  (const coreByte* pInput, const coreUint32 iInputSize, coreByte** OUTPUT ppOutput, coreUint32* OUTPUT piOutputSize, const ZSTD_CDict* pDict);
+    static coreStatus Decompress(const coreByte* pInput, const coreUint32 iInputSize, coreByte** OUTPUT ppOutput, coreUint32* OUTPUT piOutputSize, const ZSTD_DDict* pDict);
     static void       Scramble  (coreByte* OUTPUT pData, const coreUintW iSize, const coreUint64 iKey = 0u);
     static void       Unscramble(coreByte* OUTPUT pData, const coreUintW iSize, const coreUint64 iKey = 0u);
+    static void       PurgeContexts();
+
+    /* handle compression dictionaries */
+    static coreStatus  DictTrain           (const coreByte* pSamples, const coreUintW* piSampleSize, const coreUint32 iNumSamples, const coreUint32 iMaxSize, coreByte** OUTPUT ppOutput, coreUint32* OUTPUT piOutputSize);
+    static ZSTD_CDict* DictCreateCompress  (const coreByte* pData, const coreUint32 iSize, const coreInt32 iLevel = ZSTD_CLEVEL_DEFAULT);
+    static ZSTD_DDict* DictCreateDecompress(const coreByte* pData, const coreUint32 iSize);
+    static void        DictDelete          (ZSTD_CDict** OUTPUT ppDict);
+    static void        DictDelete          (ZSTD_DDict** OUTPUT ppDict);
 
     /* get compile-time type information */
     template <typename T> static const     coreChar*  TypeName();
@@ -200,6 +225,10 @@ private:
     /* prepare path for system directory */
     static const coreChar* __PrepareSystemDir(const coreChar* pcPath);
 
+    /* access cached compression contexts (created on first use) */
+    static ZSTD_CCtx* __GetCompressContext();
+    static ZSTD_DCtx* __GetDecompressContext();
+
     /* transform between 8-bit ANSI and 16-bit Unicode (for Windows API) */
     static const coreWchar* __ToWideChar(const coreChar*  pcText);
     static const coreChar*  __ToAnsiChar(const coreWchar* pcText);
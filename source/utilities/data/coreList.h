@@ -13,17 +13,17 @@
 
 // ****************************************************************
 /* base list container type */
-template <typename T> using coreListBase = std::vector<T>;
+template <typename T, typename A = std::allocator<T>> using coreListBase = std::vector<T, A>;
 
 
 // ****************************************************************
 /* list container class */
-template <typename T> class coreList : public coreListBase<T>
+template <typename T, typename A = std::allocator<T>> class coreList : public coreListBase<T, A>
 {
 private:
     /* internal types */
-    using coreIterator      = typename coreListBase<T>::iterator;
-    using coreConstIterator = typename coreListBase<T>::const_iterator;
+    using coreIterator      = typename coreListBase<T, A>::iterator;
+    using coreConstIterator = typename coreListBase<T, A>::const_iterator;
 
 
 public:
@@ -48,7 +48,7 @@ public:
 
 // ****************************************************************
 /* remove existing item without compaction */
-template <typename T> constexpr typename coreList<T>::coreIterator coreList<T>::erase_swap(const coreIterator& it)
+template <typename T, typename A> constexpr typename coreList<T, A>::coreIterator coreList<T, A>::erase_swap(const coreIterator& it)
 {
     ASSERT(!this->empty())
 
@@ -33,6 +33,41 @@
     #endif
 #endif
 
+#define CORE_RWSPINLOCK_WRITER  (0x80000000u)   // reader-writer spinlock is held by a writer
+#define CORE_RWSPINLOCK_PENDING (0x40000000u)   // writer is waiting on a reader-writer spinlock (new readers are blocked)
+#define CORE_TICKETLOCK_SPINS   (64u)           // failed attempts before a ticket spinlock yields to the OS (only the next ticket can proceed)
+#define CORE_LOCKSTATS_MAX      (64u)           // max number of different lock names with recorded statistics (only with _CORE_LOCKSTATS_)
+
+
+// ****************************************************************
+/* lock statistics structure */
+#if defined(_CORE_LOCKSTATS_)
+
+struct coreLockStats final
+{
+    const coreChar*         pcName;       // name of all locks sharing the statistics
+    std::atomic<coreUint64> iAcquired;    // number of acquisitions
+    std::atomic<coreUint64> iContended;   // number of acquisitions which had to wait
+    std::atomic<coreUint64> iSpinTime;    // total time spent waiting (in performance-counter ticks)
+
+    /* record single acquisition */
+    inline void Record(const coreBool bContended, const coreUint64 iTicks);
+
+    /* spin until acquired (and record statistics, when named) */
+    template <typename F> static FORCE_INLINE void Spin(coreLockStats* pStats, F&& nTryFunc);   // [](void) -> coreBool
+
+    /* access all statistics */
+    static coreLockStats*                    Retrieve(const coreChar* pcName);
+    template <typename F> static inline void ForEach (F&& nFunction);                         // [](const coreLockStats& oStats) -> void
+
+    /* registered statistics */
+    static coreLockStats          s_aStats[CORE_LOCKSTATS_MAX];   // statistics of all different lock names
+    static std::atomic<coreUintW> s_iNum;                         // number of registered statistics
+    static std::atomic_flag       s_bLock;                        // atomic flag to prevent concurrent registration
+};
+
+#endif
+
 
 // ****************************************************************
 /* spinlock class */
@@ -41,9 +76,13 @@ class coreSpinLock final
 private:
     std::atomic_flag m_bState;   // atomic lock state
 
+#if defined(_CORE_LOCKSTATS_)
+    coreLockStats* m_pStats;     // recorded statistics (only for named locks)
+#endif
+
 
 public:
-    constexpr coreSpinLock()noexcept : m_bState () {}
+    constexpr coreSpinLock()noexcept;
 
     DISABLE_COPY(coreSpinLock)
 
@@ -54,26 +93,112 @@ public:
 
     /* check for current lock state */
     FORCE_INLINE coreBool IsLocked()const;
+
+    /* set name for recording statistics */
+    inline void SetName(UNUSED const coreChar* pcName);
+};
+
+
+// ****************************************************************
+/* reader-writer spinlock class */
+class coreRWSpinLock final
+{
+private:
+    std::atomic<coreUint32> m_iState;   // atomic lock state (writer bit, pending writer bit, number of readers)
+
+#if defined(_CORE_LOCKSTATS_)
+    coreLockStats* m_pStats;            // recorded statistics (only for named locks)
+#endif
+
+
+public:
+    constexpr coreRWSpinLock()noexcept;
+
+    DISABLE_COPY(coreRWSpinLock)
+
+    /* acquire and release the spinlock exclusively (for writing) */
+    FORCE_INLINE void     Lock();
+    FORCE_INLINE void     Unlock();
+    FORCE_INLINE coreBool TryLock();
+
+    /* acquire and release the spinlock shared (for reading) */
+    FORCE_INLINE void     LockRead();
+    FORCE_INLINE void     UnlockRead();
+    FORCE_INLINE coreBool TryLockRead();
+
+    /* check for current lock state */
+    FORCE_INLINE coreBool IsLocked()const;
+
+    /* set name for recording statistics */
+    inline void SetName(UNUSED const coreChar* pcName);
+};
+
+
+// ****************************************************************
+/* ticket spinlock class (first come, first served) */
+class coreTicketLock final
+{
+private:
+    std::atomic<coreUint32> m_iNext;      // next ticket to hand out
+    std::atomic<coreUint32> m_iServing;   // ticket currently holding the lock
+
+#if defined(_CORE_LOCKSTATS_)
+    coreLockStats* m_pStats;              // recorded statistics (only for named locks)
+#endif
+
+
+public:
+    constexpr coreTicketLock()noexcept;
+
+    DISABLE_COPY(coreTicketLock)
+
+    /* acquire and release the spinlock */
+    FORCE_INLINE void     Lock();
+    FORCE_INLINE void     Unlock();
+    FORCE_INLINE coreBool TryLock();
+
+    /* check for current lock state */
+    FORCE_INLINE coreBool IsLocked()const;
+
+    /* set name for recording statistics */
+    inline void SetName(UNUSED const coreChar* pcName);
 };
 
 
 // ****************************************************************
 /* spinlock helper class */
-class coreSpinLocker final
+template <typename T> class coreSpinLocker final
 {
 private:
-    coreSpinLock* m_pLock;   // associated spinlock
+    T* m_pLock;   // associated spinlock
 
 
 public:
-    explicit coreSpinLocker(coreSpinLock* pLock)noexcept : m_pLock (pLock) {m_pLock->Lock();}
-    ~coreSpinLocker()                                                      {m_pLock->Unlock();}
+    explicit coreSpinLocker(T* pLock)noexcept : m_pLock (pLock) {m_pLock->Lock();}
+    ~coreSpinLocker()                                           {m_pLock->Unlock();}
 
     DISABLE_COPY(coreSpinLocker)
     DISABLE_HEAP
 };
 
 
+// ****************************************************************
+/* reader-writer spinlock helper class (for reading) */
+class coreReadLocker final
+{
+private:
+    coreRWSpinLock* m_pLock;   // associated spinlock
+
+
+public:
+    explicit coreReadLocker(coreRWSpinLock* pLock)noexcept : m_pLock (pLock) {m_pLock->LockRead();}
+    ~coreReadLocker()                                                        {m_pLock->UnlockRead();}
+
+    DISABLE_COPY(coreReadLocker)
+    DISABLE_HEAP
+};
+
+
 // ****************************************************************
 /* relaxed atomic class */
 template <typename T> class coreAtomic final
@@ -104,11 +229,26 @@ public:
 };
 
 
+// ****************************************************************
+/* constructor */
+constexpr coreSpinLock::coreSpinLock()noexcept
+: m_bState ()
+#if defined(_CORE_LOCKSTATS_)
+, m_pStats (NULL)
+#endif
+{
+}
+
+
 // ****************************************************************
 /* acquire the spinlock */
 FORCE_INLINE void coreSpinLock::Lock()
 {
+#if defined(_CORE_LOCKSTATS_)
+    coreLockStats::Spin(m_pStats, [this]() {return this->TryLock();});
+#else
     while(!this->TryLock()) CORE_SPINLOCK_YIELD
+#endif
 }
 
 
@@ -136,6 +276,191 @@ FORCE_INLINE coreBool coreSpinLock::IsLocked()const
 }
 
 
+// ****************************************************************
+/* set name for recording statistics */
+inline void coreSpinLock::SetName(UNUSED const coreChar* pcName)
+{
+#if defined(_CORE_LOCKSTATS_)
+    m_pStats = coreLockStats::Retrieve(pcName);
+#endif
+}
+
+
+// ****************************************************************
+/* constructor */
+constexpr coreRWSpinLock::coreRWSpinLock()noexcept
+: m_iState (0u)
+#if defined(_CORE_LOCKSTATS_)
+, m_pStats (NULL)
+#endif
+{
+}
+
+
+// ****************************************************************
+/* acquire the spinlock exclusively */
+FORCE_INLINE void coreRWSpinLock::Lock()
+{
+    const auto nTryFunc = [this]()
+    {
+        if(this->TryLock()) return true;
+
+        // block new readers, until the current ones are finished
+        if(!(m_iState.load(std::memory_order::relaxed) & CORE_RWSPINLOCK_PENDING)) m_iState.fetch_or(CORE_RWSPINLOCK_PENDING, std::memory_order::relaxed);
+        return false;
+    };
+
+#if defined(_CORE_LOCKSTATS_)
+    coreLockStats::Spin(m_pStats, nTryFunc);
+#else
+    while(!nTryFunc()) CORE_SPINLOCK_YIELD
+#endif
+}
+
+
+// ****************************************************************
+/* release the spinlock exclusively */
+FORCE_INLINE void coreRWSpinLock::Unlock()
+{
+    ASSERT(m_iState.load(std::memory_order::relaxed) & CORE_RWSPINLOCK_WRITER)
+    m_iState.fetch_and(~CORE_RWSPINLOCK_WRITER, std::memory_order::release);
+}
+
+
+// ****************************************************************
+/* try to acquire the spinlock exclusively */
+FORCE_INLINE coreBool coreRWSpinLock::TryLock()
+{
+    // only without writer and readers (a pending writer gets cleared)
+    coreUint32 iState = m_iState.load(std::memory_order::relaxed);
+    return !(iState & ~CORE_RWSPINLOCK_PENDING) && m_iState.compare_exchange_strong(iState, CORE_RWSPINLOCK_WRITER, std::memory_order::acquire, std::memory_order::relaxed);
+}
+
+
+// ****************************************************************
+/* acquire the spinlock shared */
+FORCE_INLINE void coreRWSpinLock::LockRead()
+{
+#if defined(_CORE_LOCKSTATS_)
+    coreLockStats::Spin(m_pStats, [this]() {return this->TryLockRead();});
+#else
+    while(!this->TryLockRead()) CORE_SPINLOCK_YIELD
+#endif
+}
+
+
+// ****************************************************************
+/* release the spinlock shared */
+FORCE_INLINE void coreRWSpinLock::UnlockRead()
+{
+    ASSERT(m_iState.load(std::memory_order::relaxed) & ~(CORE_RWSPINLOCK_WRITER | CORE_RWSPINLOCK_PENDING))
+    m_iState.fetch_sub(1u, std::memory_order::release);
+}
+
+
+// ****************************************************************
+/* try to acquire the spinlock shared */
+FORCE_INLINE coreBool coreRWSpinLock::TryLockRead()
+{
+    // only without writer (neither active nor pending)
+    coreUint32 iState = m_iState.load(std::memory_order::relaxed);
+    return !(iState & (CORE_RWSPINLOCK_WRITER | CORE_RWSPINLOCK_PENDING)) && m_iState.compare_exchange_strong(iState, iState + 1u, std::memory_order::acquire, std::memory_order::relaxed);
+}
+
+
+// ****************************************************************
+/* check for current lock state (writer or readers) */
+FORCE_INLINE coreBool coreRWSpinLock::IsLocked()const
+{
+    return (m_iState.load(std::memory_order::relaxed) & ~CORE_RWSPINLOCK_PENDING);
+}
+
+
+// ****************************************************************
+/* set name for recording statistics */
+inline void coreRWSpinLock::SetName(UNUSED const coreChar* pcName)
+{
+#if defined(_CORE_LOCKSTATS_)
+    m_pStats = coreLockStats::Retrieve(pcName);
+#endif
+}
+
+
+// ****************************************************************
+/* constructor */
+constexpr coreTicketLock::coreTicketLock()noexcept
+: m_iNext    (0u)
+, m_iServing (0u)
+#if defined(_CORE_LOCKSTATS_)
+, m_pStats   (NULL)
+#endif
+{
+}
+
+
+// ****************************************************************
+/* acquire the spinlock */
+FORCE_INLINE void coreTicketLock::Lock()
+{
+    // draw ticket and wait for its turn
+    const coreUint32 iTicket = m_iNext.fetch_add(1u, std::memory_order::relaxed);
+    coreUint32       iSpins  = 0u;
+
+    const auto nTryFunc = [&]()
+    {
+        if(m_iServing.load(std::memory_order::acquire) == iTicket) return true;
+
+        // let earlier tickets run, in case they got preempted
+        if(++iSpins >= CORE_TICKETLOCK_SPINS) {iSpins = 0u; SDL_Delay(0u);}
+        return false;
+    };
+
+#if defined(_CORE_LOCKSTATS_)
+    coreLockStats::Spin(m_pStats, nTryFunc);
+#else
+    while(!nTryFunc()) CORE_SPINLOCK_YIELD
+#endif
+}
+
+
+// ****************************************************************
+/* release the spinlock */
+FORCE_INLINE void coreTicketLock::Unlock()
+{
+    ASSERT(this->IsLocked())
+    m_iServing.fetch_add(1u, std::memory_order::release);
+}
+
+
+// ****************************************************************
+/* try to acquire the spinlock */
+FORCE_INLINE coreBool coreTicketLock::TryLock()
+{
+    // only draw a ticket, when it would be served immediately
+    const coreUint32 iServing = m_iServing.load(std::memory_order::relaxed);
+    coreUint32       iTicket  = iServing;
+    return m_iNext.compare_exchange_strong(iTicket, iServing + 1u, std::memory_order::acquire, std::memory_order::relaxed);
+}
+
+
+// ****************************************************************
+/* check for current lock state */
+FORCE_INLINE coreBool coreTicketLock::IsLocked()const
+{
+    return (m_iNext.load(std::memory_order::relaxed) != m_iServing.load(std::memory_order::relaxed));
+}
+
+
+// ****************************************************************
+/* set name for recording statistics */
+inline void coreTicketLock::SetName(UNUSED const coreChar* pcName)
+{
+#if defined(_CORE_LOCKSTATS_)
+    m_pStats = coreLockStats::Retrieve(pcName);
+#endif
+}
+
+
 // ****************************************************************
 /* assignment operations */
 template <typename T> FORCE_INLINE coreAtomic<T>& coreAtomic<T>::operator = (const T& tValue)noexcept
@@ -153,4 +478,89 @@ template <typename T> FORCE_INLINE coreAtomic<T>::operator T ()const
 }
 
 
+
+#if defined(_CORE_LOCKSTATS_)
+
+// ****************************************************************
+/* registered statistics */
+inline coreLockStats          coreLockStats::s_aStats[CORE_LOCKSTATS_MAX] = {};
+inline std::atomic<coreUintW> coreLockStats::s_iNum                       = 0u;
+inline std::atomic_flag       coreLockStats::s_bLock                      = ATOMIC_FLAG_INIT;
+
+
+// ****************************************************************
+/* record single acquisition */
+inline void coreLockStats::Record(const coreBool bContended, const coreUint64 iTicks)
+{
+    iAcquired.fetch_add(1u, std::memory_order::relaxed);
+    if(bContended)
+    {
+        iContended.fetch_add(1u,     std::memory_order::relaxed);
+        iSpinTime .fetch_add(iTicks, std::memory_order::relaxed);
+    }
+}
+
+
+// ****************************************************************
+/* spin until acquired (and record statistics, when named) */
+template <typename F> FORCE_INLINE void coreLockStats::Spin(coreLockStats* pStats, F&& nTryFunc)
+{
+    if(nTryFunc())
+    {
+        // acquired without waiting
+        if(pStats) pStats->Record(false, 0u);
+        return;
+    }
+
+    // measure time spent waiting
+    const coreUint64 iStart = pStats ? SDL_GetPerformanceCounter() : 0u;
+    do CORE_SPINLOCK_YIELD while(!nTryFunc());
+    if(pStats) pStats->Record(true, SDL_GetPerformanceCounter() - iStart);
+}
+
+
+// ****************************************************************
+/* retrieve statistics by name (shared by all locks with the same name) */
+inline coreLockStats* coreLockStats::Retrieve(const coreChar* pcName)
+{
+    if(!pcName) return NULL;
+
+    while(s_bLock.test_and_set(std::memory_order::acquire)) CORE_SPINLOCK_YIELD
+
+    // search for existing statistics
+    coreLockStats* pStats = NULL;
+    const coreUintW iNum  = s_iNum.load(std::memory_order::relaxed);
+    for(coreUintW i = 0u; i < iNum; ++i)
+    {
+        if(!std::strcmp(s_aStats[i].pcName, pcName))
+        {
+            pStats = &s_aStats[i];
+            break;
+        }
+    }
+
+    // register new statistics (ignored when full)
+    if(!pStats && (iNum < CORE_LOCKSTATS_MAX))
+    {
+        pStats = &s_aStats[iNum];
+        pStats->pcName = pcName;
+        s_iNum.store(iNum + 1u, std::memory_order::release);
+    }
+
+    s_bLock.clear(std::memory_order::release);
+    return pStats;
+}
+
+
+// ****************************************************************
+/* access all statistics */
+template <typename F> void coreLockStats::ForEach(F&& nFunction)
+{
+    const coreUintW iNum = s_iNum.load(std::memory_order::acquire);
+    for(coreUintW i = 0u; i < iNum; ++i) nFunction(s_aStats[i]);
+}
+
+#endif
+
+
 #endif /* _CORE_GUARD_SPINLOCK_H_ */
\ No newline at end of file
@@ -12,11 +12,15 @@
 // ****************************************************************
 /* constructor */
 coreFile::coreFile(const coreChar* pcPath)noexcept
-: m_sPath       (pcPath)
-, m_pData       (NULL)
-, m_iSize       (0u)
-, m_iArchivePos (UINT32_MAX)
-, m_pArchive    (NULL)
+: m_sPath         (pcPath)
+, m_pData         (NULL)
+, m_iSize         (0u)
+, m_bView         (false)
+, m_iArchivePos   (UINT64_MAX)
+, m_iArchiveSize  (0u)
+, m_iChecksum     (0u)
+, m_iArchiveFlags (0u)
+, m_pArchive      (NULL)
 {
     if(m_sPath.empty()) return;
 
@@ -30,11 +34,15 @@ coreFile::coreFile(const coreChar* pcPath)noexcept
 }
 
 coreFile::coreFile(const coreChar* pcPath, coreByte* pData, const coreUint32 iSize)noexcept
-: m_sPath       (pcPath)
-, m_pData       (pData)
-, m_iSize       (iSize)
-, m_iArchivePos (0u)
-, m_pArchive    (NULL)
+: m_sPath         (pcPath)
+, m_pData         (pData)
+, m_iSize         (iSize)
+, m_bView         (false)
+, m_iArchivePos   (0u)
+, m_iArchiveSize  (0u)
+, m_iChecksum     (0u)
+, m_iArchiveFlags (0u)
+, m_pArchive      (NULL)
 {
 }
 
@@ -44,7 +52,7 @@ coreFile::coreFile(const coreChar* pcPath, coreByte* pData, const coreUint32 iSi
 coreFile::~coreFile()
 {
     // delete file data
-    SAFE_DELETE_ARRAY(m_pData)
+    this->__DeleteData();
 }
 
 
@@ -94,7 +102,7 @@ coreStatus coreFile::Save(const coreChar* pcPath)
     }
 
     // mark file as existing
-    if(!m_pArchive && !m_iArchivePos) m_iArchivePos = UINT32_MAX;
+    if(!m_pArchive && !m_iArchivePos) m_iArchivePos = UINT64_MAX;
 
     return CORE_OK;
 }
@@ -116,7 +124,7 @@ coreStatus coreFile::Compress(const coreInt32 iLevel)
     if(eError == CORE_OK)
     {
         // delete old data
-        SAFE_DELETE_ARRAY(m_pData)
+        this->__DeleteData();
 
         // save new data
         m_pData = pNewData;
@@ -143,7 +151,7 @@ coreStatus coreFile::Decompress()
     if(eError == CORE_OK)
     {
         // delete old data
-        SAFE_DELETE_ARRAY(m_pData)
+        this->__DeleteData();
 
         // save new data
         m_pData = pNewData;
@@ -162,6 +170,9 @@ coreStatus coreFile::Scramble(const coreUint64 iKey)
     this->LoadData();
     if(!m_pData || !m_iSize) return CORE_INVALID_CALL;
 
+    // copy mapped data (read-only)
+    this->__DetachData();
+
     // scramble data
     coreData::Scramble(m_pData, m_iSize, iKey);
     return CORE_OK;
@@ -173,6 +184,9 @@ coreStatus coreFile::Unscramble(const coreUint64 iKey)
     this->LoadData();
     if(!m_pData || !m_iSize) return CORE_INVALID_CALL;
 
+    // copy mapped data (read-only)
+    this->__DetachData();
+
     // scramble data
     coreData::Unscramble(m_pData, m_iSize, iKey);
     return CORE_OK;
@@ -181,7 +195,7 @@ coreStatus coreFile::Unscramble(const coreUint64 iKey)
 
 // ****************************************************************
 /* create stream for reading file data */
-SDL_RWops* coreFile::CreateReadStream()const
+SDL_RWops* coreFile::CreateReadStream()
 {
     SDL_RWops* pFile;
     if(!m_iArchivePos)
@@ -190,6 +204,21 @@ SDL_RWops* coreFile::CreateReadStream()const
         if(!m_pData || !m_iSize) return NULL;
         pFile = SDL_RWFromConstMem(m_pData, m_iSize);
     }
+    else if(m_pArchive && !m_pData && HAS_FLAG(m_iArchiveFlags, CORE_FILE_FLAG_COMPRESSED) && (m_iSize >= CORE_FILE_STREAM_SIZE))
+    {
+        // create decompression stream (large files are never fully loaded)
+        pFile = this->__CreateDecompressStream();
+        if(!pFile) return NULL;
+    }
+    else if(m_pArchive && (m_pArchive->m_pMapping || HAS_FLAG(m_iArchiveFlags, CORE_FILE_FLAG_COMPRESSED)))
+    {
+        // load stored data first (view into archive mapping, or decompressed)
+        this->LoadData();
+
+        // create memory stream
+        if(!m_pData) return NULL;
+        pFile = SDL_RWFromConstMem(m_pData, m_iSize);
+    }
     else if(m_pArchive)
     {
         // open archive
@@ -197,7 +226,7 @@ SDL_RWops* coreFile::CreateReadStream()const
         if(!pFile) return NULL;
 
         // seek file data position
-        if(SDL_RWseek(pFile, m_iArchivePos, RW_SEEK_SET) != m_iArchivePos)
+        if(SDL_RWseek(pFile, m_iArchivePos, RW_SEEK_SET) != coreInt64(m_iArchivePos))
         {
             SDL_RWclose(pFile);
             return NULL;
@@ -228,38 +257,247 @@ coreStatus coreFile::LoadData()
 
 #endif
 
-    SDL_RWops* pFile;
-    if(m_pArchive)
+    // get size of the stored data
+    const coreUint32 iStoredSize = m_pArchive ? m_iArchiveSize : m_iSize;
+    const coreBool   bView       = m_pArchive && m_pArchive->m_pMapping;
+
+    coreByte* pStored;
+    if(bView)
     {
-        // open archive
-        pFile = SDL_RWFromFile(m_pArchive->GetPath(), "rb");
-        if(!pFile) return CORE_ERROR_FILE;
+        // reference stored data directly inside the archive mapping (no copy)
+        pStored = m_pArchive->m_pMapping + m_iArchivePos;
+    }
+    else
+    {
+        SDL_RWops* pFile;
+        if(m_pArchive)
+        {
+            // open archive
+            pFile = SDL_RWFromFile(m_pArchive->GetPath(), "rb");
+            if(!pFile) return CORE_ERROR_FILE;
+
+            // seek file data position
+            if(SDL_RWseek(pFile, m_iArchivePos, RW_SEEK_SET) != coreInt64(m_iArchivePos))
+            {
+                SDL_RWclose(pFile);
+                return CORE_ERROR_FILE;
+            }
+        }
+        else
+        {
+            // open direct file
+            pFile = SDL_RWFromFile(m_sPath.c_str(), "rb");
+            if(!pFile) return CORE_ERROR_FILE;
+        }
 
-        // seek file data position
-        if(SDL_RWseek(pFile, m_iArchivePos, RW_SEEK_SET) != m_iArchivePos)
+        coreBool bSuccess = true;
+
+        // read stored data
+        pStored = new coreByte[iStoredSize];
+        coreFile::__Read(pFile, pStored, sizeof(coreByte), iStoredSize, &bSuccess);
+
+        // close file
+        if(SDL_RWclose(pFile) || !bSuccess)
         {
-            SDL_RWclose(pFile);
+            SAFE_DELETE_ARRAY(pStored)
             return CORE_ERROR_FILE;
         }
     }
-    else
+
+    // verify and use stored data
+    return this->__ApplyData(pStored, bView);
+}
+
+
+// ****************************************************************
+/* re-read size of direct file (e.g. after external changes) */
+coreStatus coreFile::Refresh()
+{
+    // check for direct file
+    if(m_sPath.empty() || m_pArchive || (m_iArchivePos != UINT64_MAX)) return CORE_INVALID_CALL;
+
+    // delete old file data
+    this->__DeleteData();
+
+    // retrieve and clamp new file size
+    const coreInt64 iFullSize = coreData::FileSize(m_sPath.c_str());
+    m_iSize = ((iFullSize >= 0) && (iFullSize <= 0xFFFFFFFF)) ? coreUint32(iFullSize) : 0u;
+
+    return m_iSize ? CORE_OK : CORE_ERROR_FILE;
+}
+
+
+// ****************************************************************
+/* load file data of multiple files at once */
+void coreFile::LoadDataBatch(const coreList<coreFile*>& apFile, const std::function<void(const coreUintW, const coreStatus)>& nCallback)
+{
+    coreList<coreUintW> aiRead;
+    aiRead.reserve(apFile.size());
+
+    for(coreUintW i = 0u, ie = apFile.size(); i < ie; ++i)
     {
-        // open direct file
-        pFile = SDL_RWFromFile(m_sPath.c_str(), "rb");
-        if(!pFile) return CORE_ERROR_FILE;
+        coreFile* pFile = apFile[i];
+        ASSERT(pFile)
+
+        if(pFile->m_pArchive && pFile->m_iArchivePos && !pFile->m_pArchive->m_pMapping && !pFile->m_pData && pFile->m_iSize)
+        {
+            // collect files which have to be read from an archive
+            aiRead.push_back(i);
+        }
+        else
+        {
+            // load everything else directly (memory mapped, direct files, already loaded)
+            const coreStatus eStatus = pFile->LoadData();
+            if(nCallback) nCallback(i, eStatus);
+        }
     }
 
-    coreBool bSuccess = true;
+    // sort by archive and data position (duplicates next to each other)
+    std::sort(aiRead.begin(), aiRead.end(), [&](const coreUintW A, const coreUintW B)
+    {
+        const coreFile* pFileA = apFile[A];
+        const coreFile* pFileB = apFile[B];
+
+        if(pFileA->m_pArchive    != pFileB->m_pArchive)    return std::less<const coreArchive*>()(pFileA->m_pArchive, pFileB->m_pArchive);
+        if(pFileA->m_iArchivePos != pFileB->m_iArchivePos) return (pFileA->m_iArchivePos < pFileB->m_iArchivePos);
+        return std::less<const coreFile*>()(pFileA, pFileB);
+    });
+
+    // merge adjacent stored data into ranges (only separated by alignment padding)
+    struct coreRange final {coreUintW iFrom, iTo; coreUint64 iStart, iEnd;};
+    coreList<coreRange> aRange;
+    for(coreUintW i = 0u, ie = aiRead.size(); i < ie; )
+    {
+        const coreFile* pFirst = apFile[aiRead[i]];
 
-    // cache file data
-    m_pData = new coreByte[m_iSize];
-    coreFile::__Read(pFile, m_pData, sizeof(coreByte), m_iSize, &bSuccess);
+        const coreUint64 iStart = pFirst->m_iArchivePos;
+        coreUint64       iEnd   = iStart + pFirst->m_iArchiveSize;
 
-    // close file
-    if(SDL_RWclose(pFile) || !bSuccess)
+        coreUintW j = i + 1u;
+        for(; j < ie; ++j)
+        {
+            const coreFile* pNext = apFile[aiRead[j]];
+            if(pNext == apFile[aiRead[j - 1u]]) continue;   // keep all requests of the same file together
+            if(pNext->m_pArchive != pFirst->m_pArchive) break;
+
+            const coreUint64 iNewEnd = MAX(iEnd, pNext->m_iArchivePos + pNext->m_iArchiveSize);
+            if((pNext->m_iArchivePos > iEnd + CORE_FILE_ALIGNMENT) || (iNewEnd - iStart > CORE_FILE_BATCH_SIZE)) break;
+
+            iEnd = iNewEnd;
+        }
+
+        aRange.push_back({i, j, iStart, iEnd});
+        i = j;
+    }
+
+    // read all ranges concurrently (each with its own archive handle, executed directly without job worker threads)
+    Core::Manager::Job->ParallelFor(aRange.size(), 1u, [&](const coreUintW r)
     {
-        SAFE_DELETE_ARRAY(m_pData)
-        return CORE_ERROR_FILE;
+        const coreUintW  i      = aRange[r].iFrom;
+        const coreUintW  j      = aRange[r].iTo;
+        const coreUint64 iStart = aRange[r].iStart;
+
+        // read whole range
+        const coreUint32 iRange = aRange[r].iEnd - iStart;
+        coreByte*        pRange = new coreByte[iRange];
+
+        SDL_RWops*     pSource  = SDL_RWFromFile(apFile[aiRead[i]]->m_pArchive->GetPath(), "rb");
+        const coreBool bSuccess = pSource && (SDL_RWseek(pSource, iStart, RW_SEEK_SET) == coreInt64(iStart)) && (SDL_RWread(pSource, pRange, sizeof(coreByte), iRange) == iRange);
+        coreBool       bTaken   = false;
+
+        // close archive
+        if(pSource) SDL_RWclose(pSource);
+
+        for(coreUintW k = i; k < j; )
+        {
+            coreFile* pFile = apFile[aiRead[k]];
+
+            // find end of all requests of the same file
+            coreUintW n = k + 1u;
+            while((n < j) && (apFile[aiRead[n]] == pFile)) ++n;
+
+            coreStatus eStatus;
+            if(!bSuccess)
+            {
+                Core::Log->Warning("File (%s) in Archive (%s) could not be read (SDL: %s)", pFile->m_sPath.c_str(), pFile->m_pArchive->GetPath(), SDL_GetError());
+                eStatus = CORE_ERROR_FILE;
+            }
+            else if(HAS_FLAG(pFile->m_iArchiveFlags, CORE_FILE_FLAG_COMPRESSED))
+            {
+                // decompress directly from the range
+                eStatus = pFile->__ApplyData(pRange + (pFile->m_iArchivePos - iStart), true);
+            }
+            else if((pFile->m_iArchivePos == iStart) && (pFile->m_iArchiveSize == iRange) && (n == j))
+            {
+                // take over the whole range (only by the last file, duplicates before still copy from it, and ownership is passed even on failure)
+                eStatus = pFile->__ApplyData(pRange, false);
+                bTaken  = true;
+            }
+            else
+            {
+                // copy stored data out of the range
+                coreByte* pStored = new coreByte[pFile->m_iArchiveSize];
+                std::memcpy(pStored, pRange + (pFile->m_iArchivePos - iStart), pFile->m_iArchiveSize);
+
+                eStatus = pFile->__ApplyData(pStored, false);
+            }
+
+            // notify about all requests of the same file from the completing thread (do not access the file afterwards)
+            if(nCallback) for(coreUintW m = k; m < n; ++m) nCallback(aiRead[m], eStatus);
+            k = n;
+        }
+
+        if(!bTaken) SAFE_DELETE_ARRAY(pRange)
+    });
+}
+
+
+// ****************************************************************
+/* verify and use stored data (takes ownership, unless view) */
+coreStatus coreFile::__ApplyData(coreByte* pStored, const coreBool bView)
+{
+    ASSERT(pStored && !m_pData)
+
+    // get size of the stored data
+    const coreUint32 iStoredSize = m_pArchive ? m_iArchiveSize : m_iSize;
+
+    // verify stored data
+    if(m_iChecksum && (coreHashXXH64(pStored, iStoredSize) != m_iChecksum))
+    {
+        if(!bView) SAFE_DELETE_ARRAY(pStored)
+
+        Core::Log->Warning("File (%s) in Archive (%s) is corrupt (checksum mismatch)", m_sPath.c_str(), m_pArchive->GetPath());
+        return CORE_INVALID_DATA;
+    }
+
+    if(HAS_FLAG(m_iArchiveFlags, CORE_FILE_FLAG_COMPRESSED))
+    {
+        // get shared archive dictionary
+        const ZSTD_DDict* pDict = HAS_FLAG(m_iArchiveFlags, CORE_FILE_FLAG_DICTIONARY) ? m_pArchive->m_pDecompressDict : NULL;
+        WARN_IF(HAS_FLAG(m_iArchiveFlags, CORE_FILE_FLAG_DICTIONARY) && !pDict)
+        {
+            if(!bView) SAFE_DELETE_ARRAY(pStored)
+            return CORE_INVALID_DATA;
+        }
+
+        // decompress stored data
+        coreUint32 iSize = 0u;
+        const coreStatus eError = pDict ? coreData::Decompress(pStored, iStoredSize, &m_pData, &iSize, pDict) :
+                                          coreData::Decompress(pStored, iStoredSize, &m_pData, &iSize);
+
+        if(!bView) SAFE_DELETE_ARRAY(pStored)
+        if(eError != CORE_OK) return eError;
+
+        ASSERT(iSize == m_iSize)
+    }
+    else
+    {
+        // use stored data
+        m_pData = pStored;
+        m_bView = bView;
+
+        // reference archive mapping
+        if(bView) m_pArchive->m_iMappingRefs.FetchAdd(1u);
     }
 
     return CORE_OK;
@@ -284,8 +522,11 @@ void coreFile::InternalNew(coreFile** OUTPUT ppTarget, const coreFile* pSource)
     (*ppTarget) = MANAGED_NEW(coreFile, pSource->m_sPath.c_str(), pData, pSource->m_iSize);
 
     // forward archive attributes
-    (*ppTarget)->m_pArchive    = pSource->m_pArchive;
-    (*ppTarget)->m_iArchivePos = pSource->m_iArchivePos;
+    (*ppTarget)->m_pArchive      = pSource->m_pArchive;
+    (*ppTarget)->m_iArchivePos   = pSource->m_iArchivePos;
+    (*ppTarget)->m_iArchiveSize  = pSource->m_iArchiveSize;
+    (*ppTarget)->m_iChecksum     = pSource->m_iChecksum;
+    (*ppTarget)->m_iArchiveFlags = pSource->m_iArchiveFlags;
 }
 
 void coreFile::InternalDelete(coreFile** OUTPUT ppTarget)
@@ -295,6 +536,335 @@ void coreFile::InternalDelete(coreFile** OUTPUT ppTarget)
 }
 
 
+// ****************************************************************
+/* delete file data */
+void coreFile::__DeleteData()
+{
+    if(m_bView)
+    {
+        // only detach from archive mapping
+        m_pData = NULL;
+        m_bView = false;
+        m_pArchive->m_iMappingRefs.FetchSub(1u);
+    }
+    else
+    {
+        // delete owned file data
+        SAFE_DELETE_ARRAY(m_pData)
+    }
+}
+
+
+// ****************************************************************
+/* copy file data out of the archive mapping */
+void coreFile::__DetachData()
+{
+    if(!m_bView) return;
+
+    // create owned copy
+    coreByte* pData = new coreByte[m_iSize];
+    std::memcpy(pData, m_pData, m_iSize);
+
+    // replace view
+    m_pData = pData;
+    m_bView = false;
+    m_pArchive->m_iMappingRefs.FetchSub(1u);
+}
+
+
+// ****************************************************************
+/* create stream with incremental decompression of the stored data */
+SDL_RWops* coreFile::__CreateDecompressStream()const
+{
+#if defined(_CORE_EMSCRIPTEN_)
+
+    return NULL;
+
+#else
+
+    ASSERT(m_pArchive && HAS_FLAG(m_iArchiveFlags, CORE_FILE_FLAG_COMPRESSED))
+
+    // check stored data (size-prefix and frame)
+    WARN_IF(m_iArchiveSize <= sizeof(coreUint32)) return NULL;
+
+    // get shared archive dictionary
+    const ZSTD_DDict* pDict = HAS_FLAG(m_iArchiveFlags, CORE_FILE_FLAG_DICTIONARY) ? m_pArchive->m_pDecompressDict : NULL;
+    WARN_IF(HAS_FLAG(m_iArchiveFlags, CORE_FILE_FLAG_DICTIONARY) && !pDict) return NULL;
+
+    // get stored data inside the archive mapping
+    const coreByte* pMapping = m_pArchive->m_pMapping ? (m_pArchive->m_pMapping + m_iArchivePos) : NULL;
+
+    // verify stored data (only possible up-front when mapped, read mode relies on frame validation)
+    if(pMapping && m_iChecksum && (coreHashXXH64(pMapping, m_iArchiveSize) != m_iChecksum))
+    {
+        Core::Log->Warning("File (%s) in Archive (%s) is corrupt (checksum mismatch)", m_sPath.c_str(), m_pArchive->GetPath());
+        return NULL;
+    }
+
+    // allocate custom stream
+    SDL_RWops* pFile = SDL_AllocRW();
+    if(!pFile) return NULL;
+
+    // create stream state
+    coreStream* pStream = new coreStream();
+    pStream->sPath       = m_sPath;
+    pStream->pArchive    = pMapping ? m_pArchive : NULL;
+    pStream->pSource     = NULL;
+    pStream->pMapping    = pMapping;
+    pStream->iStoredPos  = m_iArchivePos;
+    pStream->iStoredSize = m_iArchiveSize;
+    pStream->pContext    = ZSTD_createDCtx();
+    pStream->pInput      = NULL;
+    pStream->iInputCap   = 0u;
+    pStream->iOutputCap  = ZSTD_DStreamOutSize();
+    pStream->pOutput     = new coreByte[pStream->iOutputCap];
+    pStream->iSize       = m_iSize;
+
+    if(!pMapping)
+    {
+        // open archive and create bounded input buffer
+        pStream->pSource   = SDL_RWFromFile(m_pArchive->GetPath(), "rb");
+        pStream->iInputCap = ZSTD_DStreamInSize();
+        pStream->pInput    = new coreByte[pStream->iInputCap];
+    }
+
+    // reference shared archive dictionary (kept over rewinds)
+    if(pDict && pStream->pContext) ZSTD_DCtx_refDDict(pStream->pContext, pDict);
+
+    // reference archive mapping (released on close)
+    if(pMapping) m_pArchive->m_iMappingRefs.FetchAdd(1u);
+
+    // create custom stream
+    pFile->size  = coreFile::__StreamSize;
+    pFile->seek  = coreFile::__StreamSeek;
+    pFile->read  = coreFile::__StreamRead;
+    pFile->write = coreFile::__StreamWrite;
+    pFile->close = coreFile::__StreamClose;
+    pFile->type  = SDL_RWOPS_UNKNOWN;
+    pFile->hidden.unknown.data1 = pStream;
+
+    // prepare first read
+    if((!pMapping && !pStream->pSource) || !pStream->pContext || !coreFile::__StreamRewind(pStream))
+    {
+        Core::Log->Warning("File (%s) in Archive (%s) could not be streamed", m_sPath.c_str(), m_pArchive->GetPath());
+
+        SDL_RWclose(pFile);
+        return NULL;
+    }
+
+    return pFile;
+
+#endif
+}
+
+
+// ****************************************************************
+/* restart decompression from the beginning of the stored data */
+coreBool coreFile::__StreamRewind(coreStream* OUTPUT pStream)
+{
+#if defined(_CORE_EMSCRIPTEN_)
+
+    return false;
+
+#else
+
+    ASSERT(pStream)
+
+    // reset decompression session (keeps dictionary)
+    if(ZSTD_isError(ZSTD_DCtx_reset(pStream->pContext, ZSTD_reset_session_only))) return false;
+
+    coreUint32 iOriginal;
+    if(pStream->pMapping)
+    {
+        // read original size and reference whole frame
+        std::memcpy(&iOriginal, pStream->pMapping, sizeof(coreUint32));
+        pStream->oInput = {pStream->pMapping + sizeof(coreUint32), pStream->iStoredSize - sizeof(coreUint32), 0u};
+    }
+    else
+    {
+        // seek stored data position and read original size
+        if(SDL_RWseek(pStream->pSource, pStream->iStoredPos, RW_SEEK_SET) != coreInt64(pStream->iStoredPos)) return false;
+        if(SDL_RWread(pStream->pSource, &iOriginal, sizeof(coreUint32), 1u) != 1u)                           return false;
+
+        // start with empty input buffer
+        pStream->oInput      = {pStream->pInput, 0u, 0u};
+        pStream->iStoredRead = sizeof(coreUint32);
+    }
+
+    // check original size
+    if(iOriginal != pStream->iSize) return false;
+
+    // reset output buffer
+    pStream->iOutputBase = 0u;
+    pStream->iOutputFill = 0u;
+    pStream->bFinished   = false;
+
+    return true;
+
+#endif
+}
+
+
+// ****************************************************************
+/* decompress next chunk into the output buffer */
+coreBool coreFile::__StreamFill(coreStream* OUTPUT pStream)
+{
+#if defined(_CORE_EMSCRIPTEN_)
+
+    return false;
+
+#else
+
+    ASSERT(pStream)
+
+    if(pStream->bFinished) return false;
+
+    // move output window behind the current chunk
+    pStream->iOutputBase += pStream->iOutputFill;
+    pStream->iOutputFill  = 0u;
+
+    ZSTD_outBuffer oOutput = {pStream->pOutput, pStream->iOutputCap, 0u};
+    while(!oOutput.pos && !pStream->bFinished)
+    {
+        if((pStream->oInput.pos == pStream->oInput.size) && pStream->pSource && (pStream->iStoredRead < pStream->iStoredSize))
+        {
+            // read next chunk of stored data
+            const coreUintW iRead = MIN(coreUintW(pStream->iStoredSize - pStream->iStoredRead), pStream->iInputCap);
+            if(SDL_RWread(pStream->pSource, pStream->pInput, sizeof(coreByte), iRead) != iRead)
+            {
+                Core::Log->Warning("File (%s) could not be streamed (SDL: %s)", pStream->sPath.c_str(), SDL_GetError());
+                return false;
+            }
+
+            pStream->oInput       = {pStream->pInput, iRead, 0u};
+            pStream->iStoredRead += iRead;
+        }
+
+        const coreBool bExhausted = (pStream->oInput.pos == pStream->oInput.size);
+
+        // decompress as much as possible
+        const coreUintW iResult = ZSTD_decompressStream(pStream->pContext, &oOutput, &pStream->oInput);
+        if(ZSTD_isError(iResult))
+        {
+            Core::Log->Warning("File (%s) could not be streamed (ZSTD: %s)", pStream->sPath.c_str(), ZSTD_getErrorName(iResult));
+            return false;
+        }
+
+        // check for end of frame (or truncated data)
+        if(!iResult) pStream->bFinished = true;
+        else if(bExhausted && !oOutput.pos && (!pStream->pSource || (pStream->iStoredRead == pStream->iStoredSize)))
+        {
+            Core::Log->Warning("File (%s) could not be streamed (truncated data)", pStream->sPath.c_str());
+            return false;
+        }
+    }
+
+    pStream->iOutputFill = oOutput.pos;
+    return (pStream->iOutputFill != 0u);
+
+#endif
+}
+
+
+// ****************************************************************
+/* implement stream callbacks */
+Sint64 SDLCALL coreFile::__StreamSize(SDL_RWops* pFile)
+{
+    const coreStream* pStream = s_cast<const coreStream*>(pFile->hidden.unknown.data1);
+    return pStream->iSize;
+}
+
+Sint64 SDLCALL coreFile::__StreamSeek(SDL_RWops* pFile, const Sint64 iOffset, const coreInt32 iWhence)
+{
+    coreStream* pStream = s_cast<coreStream*>(pFile->hidden.unknown.data1);
+
+    // calculate new read position
+    Sint64 iTarget;
+    switch(iWhence)
+    {
+    case RW_SEEK_SET: iTarget = iOffset;                      break;
+    case RW_SEEK_CUR: iTarget = iOffset + pStream->iPosition; break;
+    case RW_SEEK_END: iTarget = iOffset + pStream->iSize;     break;
+    default: return SDL_SetError("Invalid seek mode");
+    }
+
+    // only move read position (decompression is deferred until the next read)
+    pStream->iPosition = CLAMP(iTarget, 0, Sint64(pStream->iSize));
+    return pStream->iPosition;
+}
+
+size_t SDLCALL coreFile::__StreamRead(SDL_RWops* pFile, void* pPointer, const size_t iSize, const size_t iNum)
+{
+    coreStream* pStream = s_cast<coreStream*>(pFile->hidden.unknown.data1);
+    if(!iSize || !iNum) return 0u;
+
+    // only read whole objects
+    const coreUintW iTotal = MIN(iSize * iNum, ((pStream->iSize - pStream->iPosition) / iSize) * iSize);
+    coreByte*       pTarget = s_cast<coreByte*>(pPointer);
+
+    coreUintW iDone = 0u;
+    while(iDone < iTotal)
+    {
+        // restart decompression (on seeking backwards)
+        if(pStream->iPosition < pStream->iOutputBase)
+        {
+            if(!coreFile::__StreamRewind(pStream)) break;
+        }
+
+        // decompress next chunk (also skips over data on seeking forwards)
+        if(pStream->iPosition >= pStream->iOutputBase + pStream->iOutputFill)
+        {
+            if(!coreFile::__StreamFill(pStream)) break;
+            continue;
+        }
+
+        // copy from output buffer
+        const coreUintW iOffset = pStream->iPosition - pStream->iOutputBase;
+        const coreUintW iCopy   = MIN(iTotal - iDone, pStream->iOutputFill - iOffset);
+        std::memcpy(pTarget + iDone, pStream->pOutput + iOffset, iCopy);
+
+        iDone              += iCopy;
+        pStream->iPosition += iCopy;
+    }
+
+    return iDone / iSize;
+}
+
+size_t SDLCALL coreFile::__StreamWrite(SDL_RWops* pFile, const void* pPointer, const size_t iSize, const size_t iNum)
+{
+    SDL_SetError("Stream is read-only");
+    return 0u;
+}
+
+int SDLCALL coreFile::__StreamClose(SDL_RWops* pFile)
+{
+    coreStream* pStream = s_cast<coreStream*>(pFile->hidden.unknown.data1);
+
+#if !defined(_CORE_EMSCRIPTEN_)
+
+    // free decompression context
+    ZSTD_freeDCtx(pStream->pContext);
+
+#endif
+
+    // close archive
+    const coreInt32 iError = pStream->pSource ? SDL_RWclose(pStream->pSource) : 0;
+
+    // release archive mapping
+    if(pStream->pArchive) pStream->pArchive->m_iMappingRefs.FetchSub(1u);
+
+    // delete stream state
+    SAFE_DELETE_ARRAY(pStream->pInput)
+    SAFE_DELETE_ARRAY(pStream->pOutput)
+    SAFE_DELETE(pStream)
+
+    // free custom stream
+    SDL_FreeRW(pFile);
+
+    return iError;
+}
+
+
 // ****************************************************************
 /* safely read from stream */
 void coreFile::__Read(SDL_RWops* pFile, void* pPointer, const coreUintW iSize, const coreUintW iNum, coreBool* OUTPUT pbSuccess)
@@ -324,14 +894,32 @@ void coreFile::__Write(SDL_RWops* pFile, const void* pPointer, const coreUintW i
 // ****************************************************************
 /* constructor */
 coreArchive::coreArchive()noexcept
-: m_sPath  ("")
-, m_apFile {}
+: m_sPath           ("")
+, m_apFile          {}
+, m_pMapping        (NULL)
+, m_iMappingSize    (0u)
+, m_pDictionary     (NULL)
+, m_iDictionarySize (0u)
+, m_pDecompressDict (NULL)
+, m_iDirectoryPos   (0u)
+, m_bRewrite        (false)
+, m_aRetired        {}
+, m_iMappingRefs    (0u)
 {
 }
 
-coreArchive::coreArchive(const coreChar* pcPath)noexcept
-: m_sPath  (pcPath)
-, m_apFile {}
+coreArchive::coreArchive(const coreChar* pcPath, const coreBool bMapped)noexcept
+: m_sPath           (pcPath)
+, m_apFile          {}
+, m_pMapping        (NULL)
+, m_iMappingSize    (0u)
+, m_pDictionary     (NULL)
+, m_iDictionarySize (0u)
+, m_pDecompressDict (NULL)
+, m_iDirectoryPos   (0u)
+, m_bRewrite        (false)
+, m_aRetired        {}
+, m_iMappingRefs    (0u)
 {
     // open archive
     SDL_RWops* pArchive = SDL_RWFromFile(m_sPath.c_str(), "rb");
@@ -348,39 +936,95 @@ coreArchive::coreArchive(const coreChar* pcPath)noexcept
     coreFile::__Read(pArchive, &aiHead, sizeof(coreUint32), 2u, &bSuccess);
 
     // check magic number and file version
-    if((aiHead[0] != CORE_FILE_MAGIC) || (aiHead[1] != CORE_FILE_VERSION))
+    if((aiHead[0] != CORE_FILE_MAGIC) || !aiHead[1] || (aiHead[1] > CORE_FILE_VERSION))
     {
         SDL_RWclose(pArchive);
         Core::Log->Warning("Archive (%s) is not a valid CFA-file", m_sPath.c_str());
         return;
     }
 
+    // read directory position and seek directory (legacy archives have to be rewritten before appending)
+    if(aiHead[1] >= 2u)
+    {
+        coreFile::__Read(pArchive, &m_iDirectoryPos, sizeof(coreUint64), 1u, &bSuccess);
+        if(bSuccess && (SDL_RWseek(pArchive, m_iDirectoryPos, RW_SEEK_SET) != coreInt64(m_iDirectoryPos))) bSuccess = false;
+    }
+
     // read number of files
-    coreUint16 iNumFiles;
-    coreFile::__Read(pArchive, &iNumFiles, sizeof(coreUint16), 1u, &bSuccess);
+    coreUint32 iNumFiles = 0u;
+    if(aiHead[1] >= 2u)
+    {
+        coreFile::__Read(pArchive, &iNumFiles, sizeof(coreUint32), 1u, &bSuccess);
+    }
+    else
+    {
+        coreUint16 iNumFilesOld;
+        coreFile::__Read(pArchive, &iNumFilesOld, sizeof(coreUint16), 1u, &bSuccess);
+        iNumFiles = iNumFilesOld;
+    }
+
+    // read shared compression dictionary
+    if(aiHead[1] >= 2u)
+    {
+        coreUint32 iDictionarySize = 0u;
+        coreFile::__Read(pArchive, &iDictionarySize, sizeof(coreUint32), 1u, &bSuccess);
+
+        if(bSuccess && iDictionarySize)
+        {
+            coreByte* pDictionary = new coreByte[iDictionarySize];
+            coreFile::__Read(pArchive, pDictionary, sizeof(coreByte), iDictionarySize, &bSuccess);
+
+            this->__SetDictionary(pDictionary, iDictionarySize);
+        }
+    }
 
     // read file headers
     for(coreUintW i = iNumFiles; i--; )
     {
         coreUint8  iPathLen;
         coreChar   acPath[256];
+        coreUint8  iFlags;
         coreUint32 iSize;
-        coreUint32 iArchivePos;
+        coreUint32 iArchiveSize;
+        coreUint64 iArchivePos;
+        coreUint64 iChecksum;
 
         // read file header data
-        coreFile::__Read(pArchive, &iPathLen,    sizeof(coreUint8),  1u,       &bSuccess);
-        coreFile::__Read(pArchive, acPath,       sizeof(coreChar),   iPathLen, &bSuccess);
-        coreFile::__Read(pArchive, &iSize,       sizeof(coreUint32), 1u,       &bSuccess);
-        coreFile::__Read(pArchive, &iArchivePos, sizeof(coreUint32), 1u,       &bSuccess);
+        coreFile::__Read(pArchive, &iPathLen, sizeof(coreUint8), 1u,       &bSuccess);
+        coreFile::__Read(pArchive, acPath,    sizeof(coreChar),  iPathLen, &bSuccess);
         acPath[iPathLen] = '\0';
 
+        if(aiHead[1] >= 2u)
+        {
+            coreFile::__Read(pArchive, &iFlags,       sizeof(coreUint8),  1u, &bSuccess);
+            coreFile::__Read(pArchive, &iSize,        sizeof(coreUint32), 1u, &bSuccess);
+            coreFile::__Read(pArchive, &iArchiveSize, sizeof(coreUint32), 1u, &bSuccess);
+            coreFile::__Read(pArchive, &iArchivePos,  sizeof(coreUint64), 1u, &bSuccess);
+            coreFile::__Read(pArchive, &iChecksum,    sizeof(coreUint64), 1u, &bSuccess);
+        }
+        else
+        {
+            coreUint32 iArchivePosOld;
+            coreFile::__Read(pArchive, &iSize,          sizeof(coreUint32), 1u, &bSuccess);
+            coreFile::__Read(pArchive, &iArchivePosOld, sizeof(coreUint32), 1u, &bSuccess);
+            iArchivePos = iArchivePosOld;
+
+            // no compression and checksum in legacy archives
+            iFlags       = 0u;
+            iArchiveSize = iSize;
+            iChecksum    = 0u;
+        }
+
         // add new file object
         if(bSuccess)
         {
-            coreFile* pNewFile      = new coreFile(acPath, NULL, iSize);
-            pNewFile->m_pArchive    = this;
-            pNewFile->m_iArchivePos = iArchivePos;
-            m_apFile.emplace(acPath, pNewFile);
+            coreFile* pNewFile        = new coreFile(acPath, NULL, iSize);
+            pNewFile->m_pArchive      = this;
+            pNewFile->m_iArchivePos   = iArchivePos;
+            pNewFile->m_iArchiveSize  = iArchiveSize;
+            pNewFile->m_iChecksum     = iChecksum;
+            pNewFile->m_iArchiveFlags = iFlags;
+            m_apFile.emplace_bs(acPath, pNewFile);   // # saved sorted by path hash, only appends
         }
     }
 
@@ -392,7 +1036,10 @@ coreArchive::coreArchive(const coreChar* pcPath)noexcept
         return;
     }
 
-    Core::Log->Info("Archive (%s, %u files) opened", m_sPath.c_str(), iNumFiles);
+    // map whole archive into memory
+    if(bMapped) this->__Map();
+
+    Core::Log->Info("Archive (%s, %u files) opened%s", m_sPath.c_str(), iNumFiles, m_pMapping ? " (mapped)" : "");
 }
 
 
@@ -402,12 +1049,18 @@ coreArchive::~coreArchive()
 {
     // remove all file objects
     this->ClearFiles();
+
+    // unmap archive
+    this->__Unmap();
+
+    // delete compression dictionary
+    this->__SetDictionary(NULL, 0u);
 }
 
 
 // ****************************************************************
 /* save archive */
-coreStatus coreArchive::Save(const coreChar* pcPath)
+coreStatus coreArchive::Save(const coreChar* pcPath, const coreInt32 iLevel)
 {
     if(m_apFile.empty()) return CORE_INVALID_CALL;
 
@@ -415,82 +1068,175 @@ coreStatus coreArchive::Save(const coreChar* pcPath)
     if(pcPath) m_sPath = pcPath;
     ASSERT(!m_sPath.empty())
 
-    // create folder hierarchy
-    coreData::FolderCreate(m_sPath.c_str());
-
-    // write to temporary file first (to improve robustness)
-    const coreChar* pcTemp = PRINT("%s.temp_%u", m_sPath.c_str(), coreData::ProcessID());
+    // cache missing file data (works in place, due to temporary file)
+    FOR_EACH(it, m_apFile)
+        (*it)->LoadData();
 
-    // open archive
-    SDL_RWops* pArchive = SDL_RWFromFile(pcTemp, "wb");
-    if(!pArchive)
-    {
-        Core::Log->Warning("Archive (%s) could not be saved (SDL: %s)", m_sPath.c_str(), SDL_GetError());
-        return CORE_ERROR_FILE;
-    }
+    // write all files from their file data
+    return this->__Rewrite(iLevel, true);
+}
 
-    coreBool bSuccess = true;
 
-    // save magic number and file version
-    const coreUint32 aiHead[2] = {CORE_FILE_MAGIC, CORE_FILE_VERSION};
-    coreFile::__Write(pArchive, aiHead, sizeof(coreUint32), 2u, &bSuccess);
+// ****************************************************************
+/* append new files and directory to the archive */
+coreStatus coreArchive::Append(const coreInt32 iLevel)
+{
+    if(m_apFile.empty()) return CORE_INVALID_CALL;
 
-    // save number of files
-    const coreUint16 iNumFiles = m_apFile.size();
-    coreFile::__Write(pArchive, &iNumFiles, sizeof(coreUint16), 1u, &bSuccess);
+    // rewrite whole archive when it cannot be extended (legacy version, not saved yet, changed dictionary)
+    if(!m_iDirectoryPos || m_bRewrite) return this->Save(NULL, iLevel);
 
-    // cache missing file data (works in place, due to temporary file)
-    FOR_EACH(it, m_apFile)
-        (*it)->LoadData();
+    // prepare stored data of new files
+    coreStoredList oList;
+    this->__PrepareStored(iLevel, false, &oList);
 
-    // save file headers
-    this->__CalculatePositions();
-    FOR_EACH(it, m_apFile)
+    // open current archive for updating
+    SDL_RWops* pArchive = SDL_RWFromFile(m_sPath.c_str(), "r+b");
+    if(!pArchive)
     {
-        // get path length
-        const coreUint8 iPathLen = MIN(std::strlen((*it)->GetPath()), 255u);
-
-        // write header
-        coreFile::__Write(pArchive, &iPathLen,             sizeof(coreUint8),  1u,       &bSuccess);
-        coreFile::__Write(pArchive,  (*it)->GetPath(),     sizeof(coreChar),   iPathLen, &bSuccess);
-        coreFile::__Write(pArchive, &(*it)->GetSize(),     sizeof(coreUint32), 1u,       &bSuccess);
-        coreFile::__Write(pArchive, &(*it)->m_iArchivePos, sizeof(coreUint32), 1u,       &bSuccess);
+        coreArchive::__ClearStored(&oList);
+        Core::Log->Warning("Archive (%s) could not be appended (SDL: %s)", m_sPath.c_str(), SDL_GetError());
+        return CORE_ERROR_FILE;
     }
 
-    // save file data
-    FOR_EACH(it, m_apFile)
+    // calculate aligned data positions behind the current end (existing data keeps its position, new directory follows)
+    const coreInt64  iEnd          = SDL_RWsize(pArchive);
+    const coreUint64 iDirectoryPos = this->__CalculatePositions(MAX(iEnd, 0), true, &oList);
+    if(iEnd <= 0)
     {
-        coreFile::__Write(pArchive, (*it)->GetData(), sizeof(coreByte), (*it)->GetSize(), &bSuccess);
+        SDL_RWclose(pArchive);
+        coreArchive::__ClearStored(&oList);
+        Core::Log->Warning("Archive (%s) could not be appended (SDL: %s)", m_sPath.c_str(), SDL_GetError());
+        return CORE_ERROR_FILE;
     }
 
-    // close archive
+    coreBool bSuccess = (SDL_RWseek(pArchive, iEnd, RW_SEEK_SET) == iEnd);
+
+    // save new file data and new directory (old directory stays active)
+    this->__WriteData(pArchive, true, oList, &bSuccess);
+    if(bSuccess) bSuccess = (SDL_RWseek(pArchive, iDirectoryPos, RW_SEEK_SET) == coreInt64(iDirectoryPos));
+    this->__WriteDirectory(pArchive, oList, &bSuccess);
+
+    // close archive (to flush everything before switching)
     if(SDL_RWclose(pArchive) || !bSuccess)
     {
-        Core::Log->Warning("Archive (%s) could not be saved properly (SDL: %s)", m_sPath.c_str(), SDL_GetError());
+        coreArchive::__ClearStored(&oList);
+        Core::Log->Warning("Archive (%s) could not be appended properly (SDL: %s)", m_sPath.c_str(), SDL_GetError());
         return CORE_ERROR_FILE;
     }
 
-    // move temporary file over real file
-    if(coreData::FileMove(pcTemp, m_sPath.c_str()))
+    // switch to the new directory (with a single small write, everything before stays valid on failure)
+    pArchive = SDL_RWFromFile(m_sPath.c_str(), "r+b");
+    if(pArchive)
     {
-        Core::Log->Warning("Archive (%s) could not be moved", m_sPath.c_str());
+        bSuccess = (SDL_RWseek(pArchive, 2u*sizeof(coreUint32), RW_SEEK_SET) == 2u*sizeof(coreUint32));
+        coreFile::__Write(pArchive, &iDirectoryPos, sizeof(coreUint64), 1u, &bSuccess);
+
+        if(SDL_RWclose(pArchive)) bSuccess = false;
+    }
+    if(!pArchive || !bSuccess)
+    {
+        coreArchive::__ClearStored(&oList);
+        Core::Log->Warning("Archive (%s) could not switch its directory (SDL: %s)", m_sPath.c_str(), SDL_GetError());
         return CORE_ERROR_FILE;
     }
 
-    // unload file data
+    // retire old mapping (existing views stay valid)
+    const coreBool bMapped = (m_pMapping != NULL);
+    if(bMapped)
+    {
+        m_aRetired.emplace_back(m_pMapping, m_iMappingSize);
+        m_pMapping     = NULL;
+        m_iMappingSize = 0u;
+    }
+
+    // update file attributes of new files
+    m_iDirectoryPos = iDirectoryPos;
+    this->__ApplyStored(&oList);
+
+    // map extended archive
+    if(bMapped) this->__Map();
+
+    Core::Log->Info("Archive (%s) appended (%u new files)", m_sPath.c_str(), coreUint32(std::count(oList.abPending.begin(), oList.abPending.end(), true)));
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* rewrite archive without unused space */
+coreStatus coreArchive::Compact(const coreInt32 iLevel)
+{
+    if(m_apFile.empty()) return CORE_INVALID_CALL;
+
+    // stored data cannot be reused after changing the dictionary
+    if(m_bRewrite) return this->Save(NULL, iLevel);
+
+    // copy existing stored data, write new files from their file data
+    return this->__Rewrite(iLevel, false);
+}
+
+
+// ****************************************************************
+/* train shared compression dictionary */
+coreStatus coreArchive::TrainDictionary(const coreUint32 iMaxSize)
+{
+    if(m_apFile.empty()) return CORE_INVALID_CALL;
+
+    // cache all file data (may still require the old dictionary)
     FOR_EACH(it, m_apFile)
-        (*it)->UnloadData();
+        (*it)->LoadData();
+
+    // collect samples (limited per file, to focus on common headers and small files)
+    coreList<coreByte>  aiSample;
+    coreList<coreUintW> aiSampleSize;
+    FOR_EACH(it, m_apFile)
+    {
+        const coreByte*  pData = (*it)->m_pData;
+        const coreUint32 iSize = MIN((*it)->m_iSize, CORE_FILE_SAMPLE_SIZE);
+        if(!pData || !iSize) continue;
+
+        aiSample    .insert(aiSample.end(), pData, pData + iSize);
+        aiSampleSize.push_back(iSize);
+    }
+    if(aiSampleSize.empty()) return CORE_INVALID_DATA;
+
+    // train dictionary
+    coreByte*  pDictionary;
+    coreUint32 iDictionarySize;
+    const coreStatus eError = coreData::DictTrain(aiSample.data(), aiSampleSize.data(), aiSampleSize.size(), iMaxSize, &pDictionary, &iDictionarySize);
+    if(eError != CORE_OK) return eError;
+
+    // replace old dictionary (existing stored data becomes incompatible)
+    this->__SetDictionary(pDictionary, iDictionarySize);
+    m_bRewrite = true;
 
+    Core::Log->Info("Archive (%s) dictionary trained (%u samples, %.1f KB)", m_sPath.c_str(), coreUint32(aiSampleSize.size()), I_TO_F(iDictionarySize) / 1024.0f);
     return CORE_OK;
 }
 
 
+// ****************************************************************
+/* clear shared compression dictionary */
+void coreArchive::ClearDictionary()
+{
+    if(!m_pDictionary) return;
+
+    // cache all file data (still requires the old dictionary)
+    FOR_EACH(it, m_apFile)
+        (*it)->LoadData();
+
+    // remove dictionary (existing stored data becomes incompatible)
+    this->__SetDictionary(NULL, 0u);
+    m_bRewrite = true;
+}
+
+
 // ****************************************************************
 /* create file object */
 coreFile* coreArchive::CreateFile(const coreChar* pcPath, coreByte* pData, const coreUint32 iSize)
 {
     // check already existing file
-    if(m_apFile.count(pcPath))
+    if(m_apFile.count_bs(pcPath))
     {
         Core::Log->Warning("File (%s) already exists in Archive (%s)", pcPath, m_sPath.c_str());
         return NULL;
@@ -509,7 +1255,7 @@ coreFile* coreArchive::CreateFile(const coreChar* pcPath, coreByte* pData, const
 coreStatus coreArchive::AddFile(const coreChar* pcPath)
 {
     // check already existing file
-    if(m_apFile.count(pcPath))
+    if(m_apFile.count_bs(pcPath))
     {
         Core::Log->Warning("File (%s) already exists in Archive (%s)", pcPath, m_sPath.c_str());
         return CORE_INVALID_INPUT;
@@ -524,7 +1270,7 @@ coreStatus coreArchive::AddFile(coreFile* pFile)
     if(pFile->m_pArchive) return CORE_INVALID_INPUT;
 
     // check already existing file
-    if(m_apFile.count(pFile->GetPath()))
+    if(m_apFile.count_bs(pFile->GetPath()))
     {
         Core::Log->Warning("File (%s) already exists in Archive (%s)", pFile->GetPath(), m_sPath.c_str());
         return CORE_INVALID_INPUT;
@@ -533,8 +1279,8 @@ coreStatus coreArchive::AddFile(coreFile* pFile)
     // cache missing file data
     pFile->LoadData();
 
-    // add new file object
-    m_apFile.emplace(pFile->GetPath(), pFile);
+    // add new file object (sorted by path hash)
+    m_apFile.emplace_bs(pFile->GetPath(), pFile);
 
     // associate archive
     pFile->m_pArchive    = this;
@@ -559,11 +1305,11 @@ coreStatus coreArchive::DeleteFile(const coreUintW iIndex)
 
 coreStatus coreArchive::DeleteFile(const coreChar* pcPath)
 {
-    if(!m_apFile.count(pcPath)) return CORE_INVALID_INPUT;
+    if(!m_apFile.count_bs(pcPath)) return CORE_INVALID_INPUT;
 
     // remove and delete file object
-    SAFE_DELETE(m_apFile.at(pcPath))
-    m_apFile.erase(pcPath);
+    SAFE_DELETE(m_apFile.at_bs(pcPath))
+    m_apFile.erase_bs(pcPath);
 
     return CORE_OK;
 }
@@ -589,22 +1335,468 @@ void coreArchive::ClearFiles()
 
 
 // ****************************************************************
-/* calculate the data positions of all files */
-void coreArchive::__CalculatePositions()
+/* map whole archive into memory */
+coreStatus coreArchive::__Map()
 {
-    // calculate data start position
-    coreUint32 iCurPosition = 2u*sizeof(coreUint32) + sizeof(coreUint16);
+    ASSERT(!m_pMapping)
+
+    // map archive file
+    m_pMapping = s_cast<coreByte*>(coreData::FileMap(m_sPath.c_str(), &m_iMappingSize));
+    if(!m_pMapping)
+    {
+        Core::Log->Warning("Archive (%s) could not be mapped, reading files individually", m_sPath.c_str());
+        return CORE_ERROR_FILE;
+    }
+
+    // check all data positions against the mapping
     FOR_EACH(it, m_apFile)
     {
-        iCurPosition += sizeof(coreUint8) + std::strlen((*it)->GetPath()) + 2u*sizeof(coreUint32);
+        if((*it)->m_iArchivePos && ((*it)->m_iArchivePos + coreUint64((*it)->m_iArchiveSize) > m_iMappingSize))
+        {
+            // only unmap the new mapping (retired mappings may still be in use)
+            coreData::FileUnmap(m_pMapping, m_iMappingSize);
+            m_pMapping     = NULL;
+            m_iMappingSize = 0u;
+
+            Core::Log->Warning("Archive (%s) is too small for its file headers, reading files individually", m_sPath.c_str());
+            return CORE_ERROR_FILE;
+        }
     }
 
-    // set absolute data position
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* unmap whole archive */
+void coreArchive::__Unmap()
+{
+    // drop all file data views into the mappings
     FOR_EACH(it, m_apFile)
     {
-        (*it)->m_pArchive    = this;
-        (*it)->m_iArchivePos = iCurPosition;
+        if((*it)->m_bView) (*it)->__DeleteData();
+    }
+
+    // unmap archive file
+    if(m_pMapping) coreData::FileUnmap(m_pMapping, m_iMappingSize);
+
+    m_pMapping     = NULL;
+    m_iMappingSize = 0u;
+
+    // unmap retired mappings
+    FOR_EACH(it, m_aRetired) coreData::FileUnmap(it->first, it->second);
+    m_aRetired.clear();
+}
+
+
+// ****************************************************************
+/* replace the shared compression dictionary */
+void coreArchive::__SetDictionary(coreByte* pData, const coreUint32 iSize)
+{
+    // delete old dictionary
+    if(m_pDecompressDict) coreData::DictDelete(&m_pDecompressDict);
+    SAFE_DELETE_ARRAY(m_pDictionary)
+
+    // save new dictionary
+    m_pDictionary     = pData;
+    m_iDictionarySize = pData ? iSize : 0u;
+
+    if(m_pDictionary)
+    {
+        // create pre-digested dictionary for decompression
+        m_pDecompressDict = coreData::DictCreateDecompress(m_pDictionary, m_iDictionarySize);
+        if(!m_pDecompressDict) Core::Log->Warning("Archive (%s) dictionary could not be created", m_sPath.c_str());
+    }
+}
+
+
+// ****************************************************************
+/* rewrite whole archive */
+coreStatus coreArchive::__Rewrite(const coreInt32 iLevel, const coreBool bAll)
+{
+    // prepare stored data of all files
+    coreStoredList oList;
+    this->__PrepareStored(iLevel, bAll, &oList);
+
+    // calculate aligned data positions (behind magic number, file version, directory position and directory)
+    const coreUint64 iDirectoryPos = 2u*sizeof(coreUint32) + sizeof(coreUint64);
+    this->__CalculatePositions(iDirectoryPos + this->__GetDirectorySize(), false, &oList);
+
+    // create folder hierarchy
+    coreData::FolderCreate(m_sPath.c_str());
+
+    // write to temporary file first (to improve robustness)
+    const coreChar* pcTemp = PRINT("%s.temp_%u", m_sPath.c_str(), coreData::ProcessID());
 
-        iCurPosition += (*it)->GetSize();
+    // open archive
+    SDL_RWops* pArchive = SDL_RWFromFile(pcTemp, "wb");
+    if(!pArchive)
+    {
+        coreArchive::__ClearStored(&oList);
+        Core::Log->Warning("Archive (%s) could not be saved (SDL: %s)", m_sPath.c_str(), SDL_GetError());
+        return CORE_ERROR_FILE;
     }
-}
\ No newline at end of file
+
+    coreBool bSuccess = true;
+
+    // save magic number, file version and directory position
+    const coreUint32 aiHead[2] = {CORE_FILE_MAGIC, CORE_FILE_VERSION};
+    coreFile::__Write(pArchive, aiHead,         sizeof(coreUint32), 2u, &bSuccess);
+    coreFile::__Write(pArchive, &iDirectoryPos, sizeof(coreUint64), 1u, &bSuccess);
+
+    // save directory and file data
+    this->__WriteDirectory(pArchive, oList, &bSuccess);
+    this->__WriteData     (pArchive, false, oList, &bSuccess);
+
+    // close archive
+    if(SDL_RWclose(pArchive) || !bSuccess)
+    {
+        coreArchive::__ClearStored(&oList);
+        Core::Log->Warning("Archive (%s) could not be saved properly (SDL: %s)", m_sPath.c_str(), SDL_GetError());
+        return CORE_ERROR_FILE;
+    }
+
+    const coreBool bMapped = (m_pMapping != NULL);
+
+#if defined(_CORE_WINDOWS_)
+
+    if(bMapped || !m_aRetired.empty())
+    {
+        // copy file data out of all mappings (mapped files cannot be replaced)
+        FOR_EACH(it, m_apFile) (*it)->__DetachData();
+
+        // refuse while streams or file copies still read from the mappings
+        if(m_iMappingRefs)
+        {
+            coreData::FileDelete(pcTemp);
+            coreArchive::__ClearStored(&oList);
+            Core::Log->Warning("Archive (%s) could not be saved while its mapped data is still in use (%u references)", m_sPath.c_str(), coreUint32(m_iMappingRefs));
+            return CORE_INVALID_CALL;
+        }
+
+        // unmap old archive
+        this->__Unmap();
+    }
+
+#endif
+
+    // move temporary file over real file
+    if(coreData::FileMove(pcTemp, m_sPath.c_str()))
+    {
+    #if defined(_CORE_WINDOWS_)
+        if(bMapped) this->__Map();
+    #endif
+
+        coreArchive::__ClearStored(&oList);
+        Core::Log->Warning("Archive (%s) could not be moved", m_sPath.c_str());
+        return CORE_ERROR_FILE;
+    }
+
+#if !defined(_CORE_WINDOWS_)
+
+    // retire old mapping (existing views and streams stay valid, the replaced file remains accessible through it)
+    if(bMapped)
+    {
+        m_aRetired.emplace_back(m_pMapping, m_iMappingSize);
+        m_pMapping     = NULL;
+        m_iMappingSize = 0u;
+    }
+
+#endif
+
+    // update file attributes (only after success, to keep them valid for the old archive)
+    m_iDirectoryPos = iDirectoryPos;
+    m_bRewrite      = false;
+    this->__ApplyStored(&oList);
+
+    // map new archive
+    if(bMapped) this->__Map();
+
+    return CORE_OK;
+}
+
+
+// ****************************************************************
+/* prepare stored data of all files */
+void coreArchive::__PrepareStored(const coreInt32 iLevel, const coreBool bAll, coreStoredList* OUTPUT pList)const
+{
+    ASSERT(pList)
+
+    const coreUintW iNumFiles = m_apFile.size();
+
+    coreList<coreUint64> aiContent;   // hash of the file data (for finding duplicates)
+    aiContent.resize(iNumFiles, 0u);
+
+    pList->aiSource    .resize(iNumFiles, 0u);
+    pList->abPending   .resize(iNumFiles, false);
+    pList->apCompressed.resize(iNumFiles, NULL);
+    pList->aiStoredSize.resize(iNumFiles, 0u);
+    pList->aiChecksum  .resize(iNumFiles, 0u);
+    pList->aiFlags     .resize(iNumFiles, 0u);
+    pList->aiPosition  .resize(iNumFiles, 0u);
+
+    // select files without stored data in the archive
+    for(coreUintW i = 0u; i < iNumFiles; ++i)
+    {
+        pList->abPending[i] = bAll || !m_apFile[i]->m_iArchivePos;
+    }
+
+    // hash all file data
+    Core::Manager::Job->ParallelFor(iNumFiles, CORE_FILE_JOB_GRAIN, [&](const coreUintW i)
+    {
+        const coreFile* pFile = m_apFile[i];
+        if(pList->abPending[i] && pFile->m_pData && pFile->m_iSize) aiContent[i] = coreHashXXH64(pFile->m_pData, pFile->m_iSize);
+    });
+
+    // find files with identical data (always refer to the first one, to stay deterministic)
+    coreMap<coreUint64, coreUintW> aiFirst;
+    coreMap<coreUint64, coreUintW> aiFirstStored;
+    for(coreUintW i = 0u; i < iNumFiles; ++i)
+    {
+        const coreFile* pFile = m_apFile[i];
+
+        pList->aiSource[i] = i;
+
+        if(!pList->abPending[i])
+        {
+            // keep existing stored data
+            pList->aiStoredSize[i] = pFile->m_iArchiveSize;
+            pList->aiChecksum  [i] = pFile->m_iChecksum;
+            pList->aiFlags     [i] = pFile->m_iArchiveFlags;
+            pList->aiPosition  [i] = pFile->m_iArchivePos;
+            if(!pFile->m_iArchiveSize) continue;
+
+            // already shared stored data has the same position
+            if(aiFirstStored.count_bs(pFile->m_iArchivePos)) pList->aiSource[i] = aiFirstStored.at_bs(pFile->m_iArchivePos);
+                                                        else aiFirstStored.emplace_bs(pFile->m_iArchivePos, i);
+            continue;
+        }
+
+        if(!pFile->m_pData || !pFile->m_iSize) continue;
+
+        if(aiFirst.count_bs(aiContent[i]))
+        {
+            // compare whole data (hash collisions are stored separately)
+            const coreUintW j      = aiFirst.at_bs(aiContent[i]);
+            const coreFile* pFirst = m_apFile[j];
+            if((pFirst->m_iSize == pFile->m_iSize) && !std::memcmp(pFirst->m_pData, pFile->m_pData, pFile->m_iSize)) pList->aiSource[i] = j;
+        }
+        else aiFirst.emplace_bs(aiContent[i], i);
+    }
+
+    // create pre-digested dictionary for compression
+    ZSTD_CDict* pCompressDict = (iLevel && m_pDictionary) ? coreData::DictCreateCompress(m_pDictionary, m_iDictionarySize, iLevel) : NULL;
+
+    // prepare stored data of unique files
+    Core::Manager::Job->ParallelFor(iNumFiles, CORE_FILE_JOB_GRAIN, [&](const coreUintW i)
+    {
+        const coreFile* pFile = m_apFile[i];
+        if(!pList->abPending[i] || !pFile->m_pData || !pFile->m_iSize || (pList->aiSource[i] != i)) return;
+
+        pList->aiStoredSize[i] = pFile->m_iSize;
+
+        if(iLevel)
+        {
+            // compress file data, with shared dictionary if available (only keep it when it is noticeably smaller, already compressed formats are stored directly)
+            coreByte*  pData;
+            coreUint32 iSize;
+            if((pCompressDict ? coreData::Compress(pFile->m_pData, pFile->m_iSize, &pData, &iSize, pCompressDict) :
+                                coreData::Compress(pFile->m_pData, pFile->m_iSize, &pData, &iSize, iLevel)) == CORE_OK)
+            {
+                if(iSize < pFile->m_iSize - pFile->m_iSize / 8u)
+                {
+                    pList->apCompressed[i] = pData;
+                    pList->aiStoredSize[i] = iSize;
+                    pList->aiFlags     [i] = pCompressDict ? (CORE_FILE_FLAG_COMPRESSED | CORE_FILE_FLAG_DICTIONARY) : coreUint8(CORE_FILE_FLAG_COMPRESSED);
+                }
+                else SAFE_DELETE_ARRAY(pData)
+            }
+        }
+
+        // calculate checksum of stored data (same as content hash when stored uncompressed)
+        pList->aiChecksum[i] = pList->apCompressed[i] ? coreHashXXH64(pList->apCompressed[i], pList->aiStoredSize[i]) : aiContent[i];
+    });
+
+    // delete compression dictionary
+    if(pCompressDict) coreData::DictDelete(&pCompressDict);
+
+    // share stored data with duplicates
+    for(coreUintW i = 0u; i < iNumFiles; ++i)
+    {
+        const coreUintW j = pList->aiSource[i];
+        if((j == i) || !pList->abPending[i]) continue;
+
+        pList->aiStoredSize[i] = pList->aiStoredSize[j];
+        pList->aiChecksum  [i] = pList->aiChecksum  [j];
+        pList->aiFlags     [i] = pList->aiFlags     [j];
+    }
+}
+
+
+// ****************************************************************
+/* calculate absolute data positions of all files */
+coreUint64 coreArchive::__CalculatePositions(const coreUint64 iStart, const coreBool bKeep, coreStoredList* OUTPUT pList)const
+{
+    ASSERT(pList && (pList->aiSource.size() == m_apFile.size()))
+
+    coreUint64 iCurPosition = iStart;
+    for(coreUintW i = 0u, ie = m_apFile.size(); i < ie; ++i)
+    {
+        // keep position of existing stored data
+        if(bKeep && !pList->abPending[i]) continue;
+
+        if(pList->aiSource[i] != i)
+        {
+            // share position with the source (always processed before)
+            ASSERT(pList->aiSource[i] < i)
+            pList->aiPosition[i] = pList->aiPosition[pList->aiSource[i]];
+            continue;
+        }
+
+        // set aligned absolute data position
+        iCurPosition = coreMath::CeilAlign(iCurPosition, CORE_FILE_ALIGNMENT);
+        pList->aiPosition[i] = iCurPosition;
+
+        iCurPosition += pList->aiStoredSize[i];
+    }
+
+    // return end of the last stored data
+    return iCurPosition;
+}
+
+
+// ****************************************************************
+/* calculate size of the directory */
+coreUint64 coreArchive::__GetDirectorySize()const
+{
+    // number of files, shared compression dictionary, and file headers
+    coreUint64 iSize = 2u*sizeof(coreUint32) + m_iDictionarySize;
+    FOR_EACH(it, m_apFile)
+    {
+        iSize += 2u*sizeof(coreUint8) + MIN(std::strlen((*it)->GetPath()), 255u) + 2u*sizeof(coreUint32) + 2u*sizeof(coreUint64);
+    }
+
+    return iSize;
+}
+
+
+// ****************************************************************
+/* write directory */
+void coreArchive::__WriteDirectory(SDL_RWops* pArchive, const coreStoredList& oList, coreBool* OUTPUT pbSuccess)const
+{
+    // save number of files
+    const coreUint32 iNumFiles = m_apFile.size();
+    coreFile::__Write(pArchive, &iNumFiles, sizeof(coreUint32), 1u, pbSuccess);
+
+    // save shared compression dictionary
+    coreFile::__Write(pArchive, &m_iDictionarySize, sizeof(coreUint32), 1u, pbSuccess);
+    if(m_iDictionarySize) coreFile::__Write(pArchive, m_pDictionary, sizeof(coreByte), m_iDictionarySize, pbSuccess);
+
+    // save file headers (sorted by path hash, to serve as lookup index)
+    for(coreUintW i = 0u; i < iNumFiles; ++i)
+    {
+        const coreFile* pFile = m_apFile[i];
+
+        // get path length
+        const coreUint8 iPathLen = MIN(std::strlen(pFile->GetPath()), 255u);
+
+        // write header
+        coreFile::__Write(pArchive, &iPathLen,               sizeof(coreUint8),  1u,       pbSuccess);
+        coreFile::__Write(pArchive,  pFile->GetPath(),       sizeof(coreChar),   iPathLen, pbSuccess);
+        coreFile::__Write(pArchive, &oList.aiFlags     [i],  sizeof(coreUint8),  1u,       pbSuccess);
+        coreFile::__Write(pArchive, &pFile->m_iSize,         sizeof(coreUint32), 1u,       pbSuccess);
+        coreFile::__Write(pArchive, &oList.aiStoredSize[i],  sizeof(coreUint32), 1u,       pbSuccess);
+        coreFile::__Write(pArchive, &oList.aiPosition  [i],  sizeof(coreUint64), 1u,       pbSuccess);
+        coreFile::__Write(pArchive, &oList.aiChecksum  [i],  sizeof(coreUint64), 1u,       pbSuccess);
+    }
+}
+
+
+// ****************************************************************
+/* write stored data */
+void coreArchive::__WriteData(SDL_RWops* pArchive, const coreBool bKeep, const coreStoredList& oList, coreBool* OUTPUT pbSuccess)const
+{
+    static constexpr coreByte s_aiPadding[CORE_FILE_ALIGNMENT] = {};
+
+    SDL_RWops*         pSource = NULL;   // current archive (for copying existing stored data)
+    coreList<coreByte> aiBuffer;         // copy of existing stored data
+
+    // save file data (with zero-padding to the aligned positions, only once per unique data)
+    coreUint64 iCurPosition = SDL_RWtell(pArchive);
+    for(coreUintW i = 0u, ie = m_apFile.size(); i < ie; ++i)
+    {
+        const coreFile* pFile = m_apFile[i];
+
+        if((oList.aiSource[i] != i) || !oList.aiStoredSize[i]) continue;
+        if(bKeep && !oList.abPending[i])                        continue;
+
+        const coreByte* pData;
+        if(oList.abPending[i])
+        {
+            // use new stored data
+            pData = oList.apCompressed[i] ? oList.apCompressed[i] : pFile->m_pData;
+        }
+        else if(m_pMapping)
+        {
+            // use existing stored data directly from the mapping
+            pData = m_pMapping + pFile->m_iArchivePos;
+        }
+        else
+        {
+            // read existing stored data from the current archive
+            if(!pSource) pSource = SDL_RWFromFile(m_sPath.c_str(), "rb");
+            if(!pSource || (SDL_RWseek(pSource, pFile->m_iArchivePos, RW_SEEK_SET) != coreInt64(pFile->m_iArchivePos))) (*pbSuccess) = false;
+
+            aiBuffer.resize(oList.aiStoredSize[i]);
+            coreFile::__Read(pSource, aiBuffer.data(), sizeof(coreByte), oList.aiStoredSize[i], pbSuccess);
+
+            pData = aiBuffer.data();
+        }
+
+        ASSERT(oList.aiPosition[i] >= iCurPosition)
+        const coreUintW iPadding = oList.aiPosition[i] - iCurPosition;
+
+        if(iPadding) coreFile::__Write(pArchive, s_aiPadding, sizeof(coreByte), iPadding,               pbSuccess);
+                     coreFile::__Write(pArchive, pData,       sizeof(coreByte), oList.aiStoredSize[i], pbSuccess);
+
+        iCurPosition = oList.aiPosition[i] + oList.aiStoredSize[i];
+    }
+
+    // close current archive
+    if(pSource) SDL_RWclose(pSource);
+}
+
+
+// ****************************************************************
+/* update file attributes after writing */
+void coreArchive::__ApplyStored(coreStoredList* OUTPUT pList)
+{
+    ASSERT(pList)
+
+    for(coreUintW i = 0u, ie = m_apFile.size(); i < ie; ++i)
+    {
+        coreFile* pFile = m_apFile[i];
+
+        pFile->m_pArchive      = this;
+        pFile->m_iArchivePos   = pList->aiPosition  [i];
+        pFile->m_iArchiveSize  = pList->aiStoredSize[i];
+        pFile->m_iChecksum     = pList->aiChecksum  [i];
+        pFile->m_iArchiveFlags = pList->aiFlags     [i];
+
+        // unload written file data
+        if(pList->abPending[i]) pFile->UnloadData();
+    }
+
+    // delete compressed data
+    coreArchive::__ClearStored(pList);
+}
+
+
+// ****************************************************************
+/* delete compressed data */
+void coreArchive::__ClearStored(coreStoredList* OUTPUT pList)
+{
+    ASSERT(pList)
+
+    FOR_EACH(it, pList->apCompressed) SAFE_DELETE_ARRAY(*it)
+}
@@ -11,34 +11,75 @@
 #define _CORE_GUARD_ARCHIVE_H_
 
 // TODO 4: make archive a file
-// TODO 3: archive check sum (would need to read full file, maybe just for header, or check for correct size with offsets)
 // TODO 2: reference-counting wrapper instead of coreFileScope
 // TODO 5: <old comment style>
 // TODO 4: "0 = does not exist physically" should be moved into own bool and -1 should become 0 ? (could simplify if-else, seeking)
 // TODO 3: allow referencing allocation instead of owning
 // TODO 4: get rid of Internal* functions ? but files should not be copied (normally)
-// TODO 3: mmap, CreateFileMapping+MapViewOfFile instead of reading into a buffer ? unbuffered reading ? batching (e.g. DirectStorage) ?
-// TODO 2: when saving an archive fails late, file-state was already adjusted and cannot be recovered (archive-pos)
+// TODO 3: unbuffered reading ? asynchronous batching (e.g. DirectStorage, io_uring) ?
 
 
 // ****************************************************************
 /* file definitions */
-#define CORE_FILE_MAGIC   (UINT_LITERAL("CFA0"))   // magic number of core-archives
-#define CORE_FILE_VERSION (0x00000001u)            // current file version of core-archives
+#define CORE_FILE_MAGIC           (UINT_LITERAL("CFA0"))   // magic number of core-archives
+#define CORE_FILE_VERSION         (0x00000002u)            // current file version of core-archives (1 = legacy, still readable)
+#define CORE_FILE_ALIGNMENT       (4096u)                  // alignment of file data inside core-archives (for memory mapping and direct reading)
+#define CORE_FILE_DICTIONARY_SIZE (112640u)                // default max size of trained compression dictionaries
+#define CORE_FILE_SAMPLE_SIZE     (131072u)                // max size per file used as sample for dictionary training
+#define CORE_FILE_STREAM_SIZE     (0x100000u)              // min size of compressed files to be decompressed incrementally when streamed
+#define CORE_FILE_BATCH_SIZE      (0x800000u)              // max size of merged reads when loading multiple files at once
+#define CORE_FILE_JOB_GRAIN       (1u)                     // min number of files per job when preparing stored data in parallel
+
+enum coreFileFlag : coreUint8
+{
+    CORE_FILE_FLAG_COMPRESSED = 0x01u,   // stored file data is compressed
+    CORE_FILE_FLAG_DICTIONARY = 0x02u    // stored file data is compressed with the archive dictionary
+};
 
 
 // ****************************************************************
 /* file class */
 class coreFile final
 {
+private:
+    /* decompression-stream structure */
+    struct coreStream final
+    {
+        coreString      sPath;         // relative path of the file (for logging)
+        coreArchive*    pArchive;      // associated archive (referenced while reading from its mapping)
+        SDL_RWops*      pSource;       // opened archive (read mode)
+        const coreByte* pMapping;      // stored data inside the archive mapping (mapped mode)
+        coreUint64      iStoredPos;    // absolute stored data position in the archive
+        coreUint32      iStoredSize;   // size of the stored data
+        coreUint32      iStoredRead;   // stored data already read from the archive (read mode)
+
+        ZSTD_DCtx*      pContext;      // own decompression context (streams may be read from different threads)
+        ZSTD_inBuffer   oInput;        // current input window (into the input buffer or the mapping)
+        coreByte*       pInput;        // bounded input buffer (read mode)
+        coreByte*       pOutput;       // bounded output buffer
+        coreUintW       iInputCap;     // capacity of the input buffer
+        coreUintW       iOutputCap;    // capacity of the output buffer
+
+        coreUint32      iOutputBase;   // decompressed position of the first byte in the output buffer
+        coreUint32      iOutputFill;   // valid bytes in the output buffer
+        coreUint32      iPosition;     // current decompressed read position
+        coreUint32      iSize;         // size of the decompressed data
+        coreBool        bFinished;     // all stored data has been decompressed
+    };
+
+
 private:
     coreString m_sPath;           // relative path of the file
 
     coreByte*  m_pData;           // file data
     coreUint32 m_iSize;           // size of the file
+    coreBool   m_bView;           // file data is a view into the archive mapping (not owned)
 
-    coreUint32   m_iArchivePos;   // absolute data position in the associated archive (0 = does not exist physically | -1 = not associated with an archive)
-    coreArchive* m_pArchive;      // associated archive
+    coreUint64   m_iArchivePos;     // absolute data position in the associated archive (0 = does not exist physically | -1 = not associated with an archive)
+    coreUint32   m_iArchiveSize;    // size of the stored data in the associated archive (differs when compressed)
+    coreUint64   m_iChecksum;       // XXH3 checksum of the stored data (0 = not available)
+    coreUint8    m_iArchiveFlags;   // stored data flags (see coreFileFlag, compressed data is decompressed on load)
+    coreArchive* m_pArchive;        // associated archive
 
 
 public:
@@ -59,16 +100,25 @@ public:
     coreStatus Unscramble(const coreUint64 iKey = 0u);
 
     /* create stream for reading file data */
-    SDL_RWops* CreateReadStream()const;
+    SDL_RWops* CreateReadStream();
 
     /* load and unload file data */
     coreStatus LoadData();
-    inline coreStatus UnloadData() {if(!m_iArchivePos) return CORE_INVALID_CALL; SAFE_DELETE_ARRAY(m_pData) return CORE_OK;}
+    coreStatus        Refresh   ();   // re-read size of direct file (e.g. after external changes)
+    inline coreStatus UnloadData() {if(!m_iArchivePos) return CORE_INVALID_CALL; if(!m_bView) SAFE_DELETE_ARRAY(m_pData) return CORE_OK;}
+
+    /* load file data of multiple files at once (sorted and merged archive reads, issued concurrently, callback is invoked from the completing thread) */
+    static void LoadDataBatch(const coreList<coreFile*>& apFile, const std::function<void(const coreUintW, const coreStatus)>& nCallback = NULL);   // [](const coreUintW iIndex, const coreStatus eStatus) -> void
 
     /* get object properties */
     inline const coreChar*   GetPath()const {return m_sPath.c_str();}
     inline const coreByte*   GetData()      {this->LoadData(); return m_pData;}
     inline const coreUint32& GetSize()const {return m_iSize;}
+    inline const coreBool&   IsView ()const {return m_bView;}
+
+    /* get archive properties */
+    inline coreArchive*      GetArchive   ()const {return m_pArchive;}
+    inline const coreUint64& GetArchivePos()const {return m_iArchivePos;}
 
     /* handle explicit copy (for internal use) */
     static void InternalNew   (coreFile** OUTPUT ppTarget, const coreFile* pSource);
@@ -76,6 +126,27 @@ public:
 
 
 private:
+    /* verify and use stored data (takes ownership, unless view) */
+    coreStatus __ApplyData(coreByte* pStored, const coreBool bView);
+
+    /* delete or detach file data */
+    void __DeleteData();
+    void __DetachData();
+
+    /* create stream with incremental decompression of the stored data */
+    SDL_RWops* __CreateDecompressStream()const;
+
+    /* handle incremental decompression */
+    static coreBool __StreamRewind(coreStream* OUTPUT pStream);
+    static coreBool __StreamFill  (coreStream* OUTPUT pStream);
+
+    /* implement stream callbacks */
+    static Sint64 SDLCALL __StreamSize (SDL_RWops* pFile);
+    static Sint64 SDLCALL __StreamSeek (SDL_RWops* pFile, const Sint64 iOffset, const coreInt32 iWhence);
+    static size_t SDLCALL __StreamRead (SDL_RWops* pFile, void*       pPointer, const size_t iSize, const size_t iNum);
+    static size_t SDLCALL __StreamWrite(SDL_RWops* pFile, const void* pPointer, const size_t iSize, const size_t iNum);
+    static int    SDLCALL __StreamClose(SDL_RWops* pFile);
+
     /* safely read and write */
     static void __Read (SDL_RWops* pFile, void*       pPointer, const coreUintW iSize, const coreUintW iNum, coreBool* OUTPUT pbSuccess);
     static void __Write(SDL_RWops* pFile, const void* pPointer, const coreUintW iSize, const coreUintW iNum, coreBool* OUTPUT pbSuccess);
@@ -86,20 +157,53 @@ private:
 /* archive class */
 class coreArchive final
 {
+private:
+    /* stored-data structure */
+    struct coreStoredList final
+    {
+        coreList<coreUintW>  aiSource;       // index of the file with identical stored data (own index = unique)
+        coreList<coreBool>   abPending;      // stored data is created from file data (otherwise it already exists in the archive)
+        coreList<coreByte*>  apCompressed;   // compressed file data (NULL = stored uncompressed)
+        coreList<coreUint32> aiStoredSize;   // size of the stored data
+        coreList<coreUint64> aiChecksum;     // checksum of the stored data
+        coreList<coreUint8>  aiFlags;        // flags of the stored data
+        coreList<coreUint64> aiPosition;     // aligned absolute data position
+    };
+
+
 private:
     coreString m_sPath;               // relative path of the archive
-    coreMapStr<coreFile*> m_apFile;   // file objects
+    coreMapStr<coreFile*> m_apFile;   // file objects (sorted by path hash, for binary lookup)
+
+    coreByte*  m_pMapping;            // read-only memory mapping of the whole archive (NULL = files are read individually)
+    coreUint64 m_iMappingSize;        // size of the memory mapping
+
+    coreByte*   m_pDictionary;        // compression dictionary shared by all files
+    coreUint32  m_iDictionarySize;    // size of the compression dictionary
+    ZSTD_DDict* m_pDecompressDict;    // pre-digested dictionary for decompression
+
+    coreUint64 m_iDirectoryPos;       // position of the current directory (0 = archive has to be rewritten before appending)
+    coreBool   m_bRewrite;            // existing stored data became incompatible (e.g. new dictionary)
+    coreList<std::pair<coreByte*, coreUint64>> m_aRetired;   // previous memory mappings (kept valid for existing views after appending or rewriting)
+    coreAtomic<coreUint32> m_iMappingRefs;                    // number of file data views and streams into the memory mappings
 
 
 public:
     coreArchive()noexcept;
-    explicit coreArchive(const coreChar* pcPath)noexcept;
+    explicit coreArchive(const coreChar* pcPath, const coreBool bMapped = false)noexcept;
     ~coreArchive();
 
+    FRIEND_CLASS(coreFile)
     DISABLE_COPY(coreArchive)
 
-    /* save archive */
-    coreStatus Save(const coreChar* pcPath = NULL);
+    /* save archive (optionally compressing files which benefit from it, identical files share their data) */
+    coreStatus Save   (const coreChar* pcPath = NULL, const coreInt32 iLevel = 0);   // rewrite everything from file data
+    coreStatus Append (const coreInt32 iLevel = 0);                                  // only write new files and a new directory to the end (changed files have to be deleted and added again)
+    coreStatus Compact(const coreInt32 iLevel = 0);                                  // rewrite without unused space, but keep existing stored data
+
+    /* train or clear the shared compression dictionary (applied on next save, keeps all file data loaded until then) */
+    coreStatus TrainDictionary(const coreUint32 iMaxSize = CORE_FILE_DICTIONARY_SIZE);
+    void       ClearDictionary();
 
     /* manage file objects */
     coreFile*  CreateFile(const coreChar* pcPath, coreByte* pData, const coreUint32 iSize);
@@ -111,17 +215,41 @@ public:
     void ClearFiles();
 
     /* access file objects */
-    inline coreFile* GetFile(const coreUintW       iIndex) {return (iIndex < m_apFile.size()) ? m_apFile[iIndex]   : NULL;}
-    inline coreFile* GetFile(const coreHashString& sPath)  {return (m_apFile.count(sPath))    ? m_apFile.at(sPath) : NULL;}
+    inline coreFile* GetFile(const coreUintW       iIndex) {return (iIndex < m_apFile.size()) ? m_apFile[iIndex]      : NULL;}
+    inline coreFile* GetFile(const coreHashString& sPath)  {return (m_apFile.count_bs(sPath)) ? m_apFile.at_bs(sPath) : NULL;}
 
     /* get object properties */
-    inline const coreChar* GetPath    ()const {return m_sPath.c_str();}
-    inline coreUintW       GetNumFiles()const {return m_apFile.size();}
+    inline const coreChar* GetPath          ()const {return m_sPath.c_str();}
+    inline coreUintW       GetNumFiles      ()const {return m_apFile.size();}
+    inline coreUint32      GetDictionarySize()const {return m_iDictionarySize;}
+    inline coreBool        IsMapped         ()const {return (m_pMapping != NULL);}
 
 
 private:
-    /* calculate absolute data positions of all files */
-    void __CalculatePositions();
+    /* map and unmap the whole archive */
+    coreStatus __Map();
+    void       __Unmap();
+
+    /* replace the shared compression dictionary (takes ownership) */
+    void __SetDictionary(coreByte* pData, const coreUint32 iSize);
+
+    /* rewrite whole archive */
+    coreStatus __Rewrite(const coreInt32 iLevel, const coreBool bAll);
+
+    /* prepare stored data of all files (all from file data, or only files without stored data) */
+    void __PrepareStored(const coreInt32 iLevel, const coreBool bAll, coreStoredList* OUTPUT pList)const;
+
+    /* calculate absolute data positions of all files (duplicates use the position of their source) */
+    coreUint64 __CalculatePositions(const coreUint64 iStart, const coreBool bKeep, coreStoredList* OUTPUT pList)const;
+    coreUint64 __GetDirectorySize  ()const;
+
+    /* write directory and stored data */
+    void __WriteDirectory(SDL_RWops* pArchive, const coreStoredList& oList, coreBool* OUTPUT pbSuccess)const;
+    void __WriteData     (SDL_RWops* pArchive, const coreBool bKeep, const coreStoredList& oList, coreBool* OUTPUT pbSuccess)const;
+
+    /* finish or cancel writing */
+    void        __ApplyStored(coreStoredList* OUTPUT pList);
+    static void __ClearStored(coreStoredList* OUTPUT pList);
 };
 
 
@@ -17,6 +17,9 @@ coreConfig::coreConfig(const coreChar* pcPath)noexcept
 , m_bDirty     (false)
 , m_Lock       ()
 {
+    // record lock statistics (only in lock statistics mode)
+    m_Lock.SetName("config");
+
     // load configuration file
     if(this->Load() == CORE_OK)
     {
@@ -193,4 +196,18 @@ coreBool coreConfig::__RetrieveEntry(const coreHashString& sSection, const coreH
     (*ppsEntry) = &m_aasSection.at(sSection).at(sKey);
 
     return bExists;
-}
\ No newline at end of file
+}
+
+
+// ****************************************************************
+/* find existing configuration entry (without changing the container) */
+const coreString* coreConfig::__FindEntry(const coreHashString& sSection, const coreHashString& sKey)const
+{
+    const auto it = m_aasSection.find(sSection);
+    if(it == m_aasSection.end()) return NULL;
+
+    const auto et = it->find(sKey);
+    if(et == it->end()) return NULL;
+
+    return &(*et);
+}
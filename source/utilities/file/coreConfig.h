@@ -18,6 +18,10 @@
 #define CORE_CONFIG_BASE_ASYNCMODE              "Base",     "AsyncMode",          (true)    // enable asynchronous processing and resource loading
 #define CORE_CONFIG_BASE_FALLBACKMODE           "Base",     "FallbackMode",       (false)   // disable all possible hardware features
 #define CORE_CONFIG_BASE_PERSISTMODE            "Base",     "PersistMode",        (false)   // keep resources in memory
+#define CORE_CONFIG_BASE_RESOURCEBUDGET         "Base",     "ResourceBudget",     (0)       // keep unreferenced resources in memory up to this size in MiB (0 = unload after a short delay)
+#define CORE_CONFIG_BASE_MAPPEDMODE             "Base",     "MappedMode",         (true)    // map resource archives into memory instead of reading each file
+#define CORE_CONFIG_BASE_HOTRELOAD              "Base",     "HotReload",          (false)   // reload resources automatically when their direct resource files change
+#define CORE_CONFIG_BASE_DIRECTMODE             "Base",     "DirectMode",         (false)   // prefer direct resource files over files in resource archives (checks the file system per lookup)
 
 #define CORE_CONFIG_SYSTEM_DISPLAY              "System",   "Display",            (0)
 #define CORE_CONFIG_SYSTEM_WIDTH                "System",   "Width",              (0)
@@ -56,9 +60,9 @@ private:
 private:
     coreMapStrFull<coreSection> m_aasSection;   // configuration sections with configuration entries
 
-    coreString   m_sPath;                       // relative path of the file
-    coreBool     m_bDirty;                      // status flag for pending changes
-    coreSpinLock m_Lock;                        // spinlock to prevent concurrent configuration access
+    coreString     m_sPath;                     // relative path of the file
+    coreBool       m_bDirty;                    // status flag for pending changes
+    coreRWSpinLock m_Lock;                      // spinlock to prevent concurrent configuration access (shared for reading)
 
 
 public:
@@ -82,10 +86,10 @@ public:
     inline void SetString(const coreHashString& sSection, const coreHashString& sKey,                  const coreChar* pcValue) {coreSpinLocker oLocker(&m_Lock); coreString* psEntry; if(!this->__RetrieveEntry(sSection, sKey, &psEntry) || std::strcmp(psEntry->c_str(), pcValue)) {m_bDirty = true; (*psEntry) = pcValue;}}
 
     /* get configuration values */
-    inline coreBool        GetBool  (const coreHashString& sSection, const coreHashString& sKey, const coreBool  bDefault)  {coreSpinLocker oLocker(&m_Lock); coreString* psEntry; if(!this->__RetrieveEntry(sSection, sKey, &psEntry)) {m_bDirty = true; (*psEntry) = coreConfig::__FromBool (bDefault);} return coreConfig::__ToBool (*psEntry);}
-    inline coreInt32       GetInt   (const coreHashString& sSection, const coreHashString& sKey, const coreInt32 iDefault)  {coreSpinLocker oLocker(&m_Lock); coreString* psEntry; if(!this->__RetrieveEntry(sSection, sKey, &psEntry)) {m_bDirty = true; (*psEntry) = coreConfig::__FromInt  (iDefault);} return coreConfig::__ToInt  (*psEntry);}
-    inline coreFloat       GetFloat (const coreHashString& sSection, const coreHashString& sKey, const coreFloat fDefault)  {coreSpinLocker oLocker(&m_Lock); coreString* psEntry; if(!this->__RetrieveEntry(sSection, sKey, &psEntry)) {m_bDirty = true; (*psEntry) = coreConfig::__FromFloat(fDefault);} return coreConfig::__ToFloat(*psEntry);}
-    inline const coreChar* GetString(const coreHashString& sSection, const coreHashString& sKey, const coreChar* pcDefault) {coreSpinLocker oLocker(&m_Lock); coreString* psEntry; if(!this->__RetrieveEntry(sSection, sKey, &psEntry)) {m_bDirty = true; (*psEntry) = pcDefault;}                         return psEntry->c_str();}
+    inline coreBool        GetBool  (const coreHashString& sSection, const coreHashString& sKey, const coreBool  bDefault)  {return this->__GetValue(sSection, sKey, coreConfig::__ToBool,                                [&]() {return coreConfig::__FromBool (bDefault);});}
+    inline coreInt32       GetInt   (const coreHashString& sSection, const coreHashString& sKey, const coreInt32 iDefault)  {return this->__GetValue(sSection, sKey, coreConfig::__ToInt,                                 [&]() {return coreConfig::__FromInt  (iDefault);});}
+    inline coreFloat       GetFloat (const coreHashString& sSection, const coreHashString& sKey, const coreFloat fDefault)  {return this->__GetValue(sSection, sKey, coreConfig::__ToFloat,                               [&]() {return coreConfig::__FromFloat(fDefault);});}
+    inline const coreChar* GetString(const coreHashString& sSection, const coreHashString& sKey, const coreChar* pcDefault) {return this->__GetValue(sSection, sKey, [](const coreString& sString) {return sString.c_str();}, [&]() {return pcDefault;});}
 
     /* get object properties */
     inline const coreChar* GetPath()const {return m_sPath.c_str();}
@@ -93,7 +97,11 @@ public:
 
 private:
     /* retrieve configuration entry */
-    coreBool __RetrieveEntry(const coreHashString& sSection, const coreHashString& sKey, coreString** OUTPUT ppsEntry);
+    coreBool          __RetrieveEntry(const coreHashString& sSection, const coreHashString& sKey, coreString** OUTPUT ppsEntry);
+    const coreString* __FindEntry    (const coreHashString& sSection, const coreHashString& sKey)const;
+
+    /* get converted configuration value (shared lookup first, exclusive creation only when missing) */
+    template <typename F, typename G> auto __GetValue(const coreHashString& sSection, const coreHashString& sKey, F&& nConvertFunc, G&& nDefaultFunc)->decltype(nConvertFunc(coreString()));
 
     /* convert to type */
     static inline coreBool  __ToBool (const coreString& sString) {return (sString[0] == 't') || (sString[0] == 'T') || (sString[0] == '1');}
@@ -107,4 +115,25 @@ private:
 };
 
 
+// ****************************************************************
+/* get converted configuration value */
+template <typename F, typename G> auto coreConfig::__GetValue(const coreHashString& sSection, const coreHashString& sKey, F&& nConvertFunc, G&& nDefaultFunc)->decltype(nConvertFunc(coreString()))
+{
+    {
+        coreReadLocker oLocker(&m_Lock);
+
+        // look for existing configuration entry (concurrent with other readers)
+        const coreString* psEntry = this->__FindEntry(sSection, sKey);
+        if(psEntry) return nConvertFunc(*psEntry);
+    }
+
+    coreSpinLocker oLocker(&m_Lock);
+
+    // create missing configuration entry with default value
+    coreString* psEntry;
+    if(!this->__RetrieveEntry(sSection, sKey, &psEntry)) {m_bDirty = true; (*psEntry) = nDefaultFunc();}
+    return nConvertFunc(*psEntry);
+}
+
+
 #endif /* _CORE_GUARD_CONFIG_H_ */
\ No newline at end of file
@@ -21,6 +21,9 @@ coreLog::coreLog(const coreChar* pcPath)noexcept
 , m_Lock        ()
 , m_sWorkString ("")
 {
+    // record lock statistics (only in lock statistics mode)
+    m_Lock.SetName("log");
+
 #if !defined(_CORE_EMSCRIPTEN_)
 
     // open and reset log file